@@ -0,0 +1,59 @@
+#pragma once
+
+#include <jank/analyze/expression_base.hpp>
+#include <jank/detail/to_runtime_data.hpp>
+#include <jank/runtime/seq.hpp>
+
+namespace jank::analyze::expr
+{
+  /* `(case* value default (test ...) then ...)`
+   *
+   * Each test is a constant which we compare against the value. Every test in a clause maps
+   * to the same branch, so the branches are only generated once. */
+  template <typename E>
+  struct case_ : expression_base
+  {
+    native_box<E> value_expr{};
+    native_box<E> default_expr{};
+    native_vector<native_box<E>> branches;
+    /* Each test constant, paired with the index of its branch. */
+    native_vector<std::pair<runtime::object_ptr, size_t>> tests;
+    /* When every test is an integer, we can switch on the integer itself, rather than its
+     * hash, and skip the equality checks. */
+    native_bool all_integers{};
+
+    runtime::object_ptr to_runtime_data() const
+    {
+      runtime::object_ptr branch_maps(make_box<runtime::obj::persistent_vector>());
+      for(auto const &e : branches)
+      {
+        branch_maps = runtime::conj(branch_maps, e->to_runtime_data());
+      }
+
+      runtime::object_ptr test_maps(make_box<runtime::obj::persistent_vector>());
+      for(auto const &e : tests)
+      {
+        test_maps = runtime::conj(test_maps,
+                                  make_box<runtime::obj::persistent_vector>(
+                                    std::in_place,
+                                    e.first,
+                                    make_box(static_cast<native_integer>(e.second))));
+      }
+
+      return runtime::merge(
+        static_cast<expression_base const *>(this)->to_runtime_data(),
+        runtime::obj::persistent_array_map::create_unique(make_box("__type"),
+                                                          make_box("expr::case"),
+                                                          make_box("value_expr"),
+                                                          value_expr->to_runtime_data(),
+                                                          make_box("default_expr"),
+                                                          default_expr->to_runtime_data(),
+                                                          make_box("branches"),
+                                                          branch_maps,
+                                                          make_box("tests"),
+                                                          test_maps,
+                                                          make_box("all_integers"),
+                                                          make_box(all_integers)));
+    }
+  };
+}
@@ -13,12 +13,19 @@ namespace jank::analyze::expr
 {
   struct function_context : gc
   {
-    static constexpr native_bool pointer_free{ true };
+    static constexpr native_bool pointer_free{ false };
+    static constexpr native_bool arena_allocated{ true };
 
     size_t param_count{};
     native_bool is_variadic{};
     native_bool is_tail_recursive{};
-    /* TODO: is_pure */
+    /* TODO: is_pure, inferred from the body. For now, only vars with `:pure` meta are folded. */
+    /* Loops are recur targets too, so each loop* gets its own context. In that case, recur
+     * rebinds these loop locals, in order, instead of the fn params. */
+    option<local_frame_ptr> loop_frame;
+    native_vector<runtime::obj::symbol_ptr> loop_params;
+    /* Indices of loop locals which recur can't keep unboxed. */
+    native_set<size_t> loop_boxed_params;
   };
 
   using function_context_ptr = native_box<function_context>;
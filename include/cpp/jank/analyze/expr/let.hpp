@@ -21,6 +21,9 @@ namespace jank::analyze::expr
 
     native_vector<pair_type> pairs;
     do_<E> body;
+    /* A loop* is a let which is also a recur target. Its bindings are mutable and recur
+     * rebinds them in place. */
+    native_bool is_loop{};
 
     runtime::object_ptr to_runtime_data() const
     {
@@ -41,6 +44,8 @@ namespace jank::analyze::expr
                                                           make_box("expr::let"),
                                                           make_box("pairs"),
                                                           pair_maps,
+                                                          make_box("is_loop"),
+                                                          make_box(is_loop),
                                                           make_box("body"),
                                                           detail::to_runtime_data(body)));
     }
@@ -3,6 +3,7 @@
 #include <memory>
 
 #include <jank/runtime/obj/persistent_list.hpp>
+#include <jank/analyze/expr/function.hpp>
 #include <jank/analyze/expression_base.hpp>
 #include <jank/runtime/seq.hpp>
 
@@ -13,6 +14,8 @@ namespace jank::analyze::expr
   {
     runtime::obj::persistent_list_ptr args{};
     native_vector<native_box<E>> arg_exprs;
+    /* Set when recurring to a loop* rather than to the enclosing fn. */
+    option<function_context_ptr> loop_ctx;
 
     runtime::object_ptr to_runtime_data() const
     {
@@ -29,7 +32,9 @@ namespace jank::analyze::expr
                                                           make_box("args"),
                                                           args,
                                                           make_box("arg_exprs"),
-                                                          arg_expr_maps));
+                                                          arg_expr_maps,
+                                                          make_box("loop"),
+                                                          make_box(loop_ctx.is_some())));
     }
   };
 }
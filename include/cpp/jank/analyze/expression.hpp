@@ -18,6 +18,7 @@
 #include <jank/analyze/expr/let.hpp>
 #include <jank/analyze/expr/do.hpp>
 #include <jank/analyze/expr/if.hpp>
+#include <jank/analyze/expr/case.hpp>
 #include <jank/analyze/expr/throw.hpp>
 #include <jank/analyze/expr/try.hpp>
 #include <jank/analyze/expr/native_raw.hpp>
@@ -41,11 +42,13 @@ namespace jank::analyze
                                       expr::let<E>,
                                       expr::do_<E>,
                                       expr::if_<E>,
+                                      expr::case_<E>,
                                       expr::throw_<E>,
                                       expr::try_<E>,
                                       expr::native_raw<E>>;
 
     static constexpr native_bool pointer_free{ false };
+    static constexpr native_bool arena_allocated{ true };
 
     expression() = default;
     expression(expression const &) = default;
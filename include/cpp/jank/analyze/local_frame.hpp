@@ -5,6 +5,7 @@
 #include <jank/runtime/context.hpp>
 #include <jank/runtime/obj/symbol.hpp>
 #include <jank/option.hpp>
+#include <jank/analyze/shape.hpp>
 
 namespace jank::analyze
 {
@@ -42,6 +43,24 @@ namespace jank::analyze
     native_bool needs_box{ true };
     native_bool has_boxed_usage{};
     native_bool has_unboxed_usage{};
+    /* Loop locals are mutated by recur, so an unboxed loop local needs a single native
+     * type for its whole lifetime. This is either integer or real. */
+    option<runtime::object_type> unboxed_type{};
+    /* Every reference to this local, and how many of those are direct calls, from within the
+     * same fn, with an arg count matching one of the value's fixed arities. If they're equal,
+     * the value can't escape. */
+    size_t reference_count{};
+    size_t direct_call_count{};
+    /* How many of those references only read from the value for the duration of the call
+     * they're in, like `(first xs)` or `(if xs ...)`. If this equals the reference count,
+     * a rest param can be left on the caller's stack. */
+    size_t borrowed_reference_count{};
+    /* Set by the owning let for fn values which can't escape. These are built on the stack,
+     * rather than boxed, and calls to them are direct. */
+    native_bool is_stack_allocated{};
+    /* From the value, for let bindings, or from a `^vector` or `^map` hint. Loop locals only
+     * use the hint, since recur can rebind them to anything. */
+    option<value_shape> shape;
 
     runtime::object_ptr to_runtime_data() const;
   };
@@ -57,6 +76,8 @@ namespace jank::analyze
     };
 
     static constexpr native_bool pointer_free{ false };
+    /* Except for the root frame, which outlives every form. */
+    static constexpr native_bool arena_allocated{ true };
 
     local_frame() = delete;
     local_frame(local_frame const &) = default;
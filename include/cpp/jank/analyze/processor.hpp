@@ -76,11 +76,41 @@ namespace jank::analyze
                                   expression_type,
                                   option<expr::function_context_ptr> const &,
                                   native_bool needs_box);
+    expression_result analyze_loop(runtime::obj::persistent_list_ptr const &,
+                                   local_frame_ptr &,
+                                   expression_type,
+                                   option<expr::function_context_ptr> const &,
+                                   native_bool needs_box);
+
+    /* A recur form in tail position of a loop body, along with the names bound around it. */
+    struct tail_recur
+    {
+      runtime::obj::persistent_list_ptr form;
+      native_set<runtime::obj::symbol_ptr> shadowed;
+    };
+
+    /* Recur can only keep a loop local unboxed if every value it's given has the same native
+     * type. These find that from the forms alone, before the loop body is analyzed, so the
+     * body is only analyzed once. Macros in tail position are expanded to find the recurs. */
+    void find_tail_recurs(runtime::object_ptr form,
+                          native_set<runtime::obj::symbol_ptr> const &shadowed,
+                          native_vector<tail_recur> &found);
+    option<runtime::object_type>
+    recur_arg_type(runtime::object_ptr form,
+                   native_set<runtime::obj::symbol_ptr> const &shadowed,
+                   native_vector<runtime::obj::symbol_ptr> const &params,
+                   native_vector<option<runtime::object_type>> const &param_types,
+                   local_frame_ptr const &outer_frame);
     expression_result analyze_if(runtime::obj::persistent_list_ptr const &,
                                  local_frame_ptr &,
                                  expression_type,
                                  option<expr::function_context_ptr> const &,
                                  native_bool needs_box);
+    expression_result analyze_case(runtime::obj::persistent_list_ptr const &,
+                                   local_frame_ptr &,
+                                   expression_type,
+                                   option<expr::function_context_ptr> const &,
+                                   native_bool needs_box);
     expression_result analyze_quote(runtime::obj::persistent_list_ptr const &,
                                     local_frame_ptr &,
                                     expression_type,
@@ -130,6 +160,12 @@ namespace jank::analyze
     /* Returns whether or not the form is a special symbol. */
     native_bool is_special(runtime::object_ptr form);
 
+    /* Calls to vars marked `:pure` with only constant args can be evaluated during analysis.
+     * Vars marked `:pure :numbers` also need all of those args to be numbers. Returns the
+     * result, if the call could be folded into a constant. */
+    option<runtime::object_ptr> fold_pure_call(runtime::var_ptr var,
+                                               native_vector<expression_ptr> const &arg_exprs);
+
     using special_function_type
       = std::function<expression_result(runtime::obj::persistent_list_ptr const &,
                                         local_frame_ptr &,
@@ -138,7 +174,9 @@ namespace jank::analyze
                                         native_bool)>;
 
     native_unordered_map<runtime::obj::symbol_ptr, special_function_type> specials;
-    native_unordered_map<runtime::var_ptr, expression_ptr> vars;
+    /* Whether each var we've analyzed a def for was bound to a fn. We only keep that, rather
+     * than the value's expression, since expressions don't outlive their form. */
+    native_unordered_map<runtime::var_ptr, native_bool> vars;
     runtime::context &rt_ctx;
     local_frame_ptr root_frame;
   };
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <jank/runtime/context.hpp>
+#include <jank/option.hpp>
+
+namespace jank::analyze
+{
+  struct expression;
+
+  /* What we know, at compile time, about the collection a value will be. Hand destructuring
+   * is a pile of `nth` and `get` calls on the same value, each of which would otherwise go
+   * through a generic dispatch on its type. When we know the shape, codegen can load from the
+   * collection directly. */
+  struct value_shape
+  {
+    enum class kind
+    {
+      vector,
+      map
+    };
+
+    runtime::object_ptr to_runtime_data() const;
+
+    kind type{};
+    /* Literals give us the exact shape. Type hints are only a promise, so anything relying on
+     * a hinted shape needs to check the type at run time. */
+    native_bool exact{};
+    /* Exact vectors know their size. */
+    option<size_t> size;
+    /* Exact maps built from constant keys, small enough to be array maps, know the slot of
+     * each key. These are the keys, in slot order. */
+    option<native_vector<runtime::object_ptr>> keys;
+  };
+
+  /* `^vector` and `^map`, or the same as keywords. */
+  option<value_shape>
+  shape_from_meta(runtime::context &rt_ctx, option<runtime::object_ptr> const &meta);
+
+  /* Vector and map literals, locals bound to them or hinted, and calls to vars whose return
+   * is hinted, all have a known shape. */
+  option<value_shape> find_shape(runtime::context &rt_ctx, native_box<expression> const &expr);
+}
@@ -115,6 +115,9 @@ namespace jank::codegen
     option<handle> gen(analyze::expr::if_<analyze::expression> const &,
                        analyze::expr::function_arity<analyze::expression> const &,
                        native_bool box_needed);
+    option<handle> gen(analyze::expr::case_<analyze::expression> const &,
+                       analyze::expr::function_arity<analyze::expression> const &,
+                       native_bool box_needed);
     option<handle> gen(analyze::expr::throw_<analyze::expression> const &,
                        analyze::expr::function_arity<analyze::expression> const &,
                        native_bool box_needed);
@@ -125,6 +128,9 @@ namespace jank::codegen
                        analyze::expr::function_arity<analyze::expression> const &,
                        native_bool box_needed);
 
+    option<handle> gen_loop(analyze::expr::let<analyze::expression> const &,
+                            analyze::expr::function_arity<analyze::expression> const &);
+
     native_persistent_string declaration_str();
     void build_header();
     void build_body();
@@ -150,6 +156,11 @@ namespace jank::codegen
                              native_vector<native_box<analyze::expression>> const &arg_exprs,
                              analyze::expr::function_arity<analyze::expression> const &fn_arity,
                              native_bool arg_box_needed);
+    /* Generates nothing and returns false if the collection's shape isn't known. */
+    native_bool
+    format_shaped_access(analyze::expr::call<analyze::expression> const &expr,
+                         native_persistent_string_view const &ret_tmp,
+                         analyze::expr::function_arity<analyze::expression> const &fn_arity);
 
     runtime::context &rt_ctx;
     /* This is stored just to keep the expression alive. */
@@ -165,5 +176,8 @@ namespace jank::codegen
     fmt::memory_buffer expression_buffer;
     native_bool generated_declaration{};
     native_bool generated_expression{};
+    /* Nested fns are declared along with this one, but their instances can outlive it, so
+     * this fn's code needs to stay loaded even once it's unreachable. */
+    native_bool has_nested_fns{};
   };
 }
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <type_traits>
+
+#include <gc/gc_cpp.h>
+#include <gc/gc_typed.h>
+
+namespace jank::detail
+{
+  /* Leaves, like numbers and the characters of a string, can't hold pointers, so the GC
+   * never needs to scan them. Object types opt in with `pointer_free`. */
+  template <typename T>
+  concept gc_pointer_free
+    = std::is_arithmetic_v<T> || std::is_enum_v<T> || requires { requires T::pointer_free; };
+
+  /* Every GC allocation of a T, or an array of them, should go through this placement, so
+   * leaves are allocated atomically. */
+  template <typename T>
+  constexpr GCPlacement gc_placement()
+  {
+    return gc_pointer_free<T> ? PointerFreeGC : UseGC;
+  }
+
+  /* By default, the GC scans every word of an object, looking for anything which might be a
+   * pointer. Object types can instead publish which of their words may hold pointers, by
+   * specializing this, and `make_box` will allocate them with that layout. Words outside of
+   * the layout, such as hashes, sizes, and flags, are then never mistaken for pointers.
+   *
+   * Only the exact type is described. Types deriving from a described type, such as our
+   * generated fns, add members of their own and so fall back to conservative scanning. */
+  template <typename T>
+  struct gc_layout;
+
+  template <typename T>
+  concept gc_described = requires { gc_layout<T>::descriptor(); };
+
+  /* Marks every word covered by each of the given members. The members themselves may be
+   * anything which holds pointers, like an immer vector or an option, so they're still scanned
+   * conservatively; we just skip the words in between. */
+  template <typename T, auto... Members>
+  struct gc_fields
+  {
+    static GC_descr descriptor()
+    {
+      static GC_descr const descr{ [] {
+        GC_word bitmap[GC_BITMAP_SIZE(T)]{};
+        alignas(T) unsigned char const storage[sizeof(T)]{};
+        auto const * const t(reinterpret_cast<T const *>(storage));
+        (mark(bitmap, storage, &(t->*Members)), ...);
+        return GC_make_descriptor(bitmap, GC_WORD_LEN(T));
+      }() };
+      return descr;
+    }
+
+    template <typename F>
+    static void
+    mark(GC_word * const bitmap, unsigned char const * const storage, F const * const field)
+    {
+      auto const offset(
+        static_cast<size_t>(reinterpret_cast<unsigned char const *>(field) - storage));
+      auto const last((offset + sizeof(F) - 1) / sizeof(GC_word));
+      for(size_t i{ offset / sizeof(GC_word) }; i <= last; ++i)
+      {
+        GC_set_bit(bitmap, i);
+      }
+    }
+  };
+}
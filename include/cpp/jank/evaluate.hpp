@@ -46,6 +46,9 @@ namespace jank::evaluate
   eval(runtime::context &, jit::processor const &, analyze::expr::do_<analyze::expression> const &);
   runtime::object_ptr
   eval(runtime::context &, jit::processor const &, analyze::expr::if_<analyze::expression> const &);
+  runtime::object_ptr eval(runtime::context &,
+                           jit::processor const &,
+                           analyze::expr::case_<analyze::expression> const &);
   runtime::object_ptr eval(runtime::context &,
                            jit::processor const &,
                            analyze::expr::throw_<analyze::expression> const &);
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
+#include <vector>
 
 #include <cling/Interpreter/Interpreter.h>
 
@@ -14,6 +16,52 @@ namespace jank::runtime
 
 namespace jank::jit
 {
+  /* How much JIT compiled code has been declared, and how much of it has since been unloaded.
+   * Sizes are of the generated C++, since that's what we have on hand; the machine code and
+   * AST built from it grow with it. These cover every processor. */
+  struct code_stats
+  {
+    size_t declared_units{};
+    size_t declared_bytes{};
+    /* Units whose fn has been collected, but which are still loaded. */
+    size_t unreachable_units{};
+    size_t unloaded_units{};
+    size_t unloaded_bytes{};
+  };
+
+  code_stats current_code_stats();
+
+  /* The transactions from one call to `eval`: the declarations and the expression which
+   * builds the fn. Cling can only revert its latest transaction, so a unit can only be
+   * unloaded once `last` is the latest one, by reverting everything after `previous`. */
+  struct code_unit
+  {
+    cling::Transaction const *previous{};
+    cling::Transaction const *last{};
+    size_t bytes{};
+  };
+
+  /* Finalizers queue units here, from whichever thread is allocating at the time, so this is
+   * locked. It's shared with the finalizers, since a fn can outlive its processor. */
+  struct unreachable_units
+  {
+    std::mutex mutex;
+    /* This is the normal heap, since the GC may run finalizers while we allocate from it. */
+    std::vector<code_unit> units;
+  };
+
+  /* Held whenever JIT compiled code may be running on this thread. Each way into that code
+   * from native code holds one, like `context::eval_string`, so that unloading can tell
+   * whether any such code is on any thread's stack. Threads started by native code need one
+   * for as long as they run jank fns. */
+  struct entry
+  {
+    entry();
+    entry(entry const &) = delete;
+    entry(entry &&) = delete;
+    ~entry();
+  };
+
   struct processor
   {
     processor(runtime::context &rt_ctx, native_integer optimization_level);
@@ -23,7 +71,15 @@ namespace jank::jit
     void eval_string(native_persistent_string const &s) const;
     void load_object(native_persistent_string_view const &path) const;
 
+    /* Unloads the code of fns which have been collected so far, newest first, for as long as
+     * the latest unit is one of them. Units under code which is still reachable stay queued,
+     * until that code is unloaded too. Code for a fn may still be on the stack, even once the
+     * fn itself is gone, so nothing is unloaded while any `entry` is held. The REPL calls this
+     * between inputs. Returns whether the queue was handled. */
+    native_bool unload_unreachable() const;
+
     std::unique_ptr<cling::Interpreter> interpreter;
     native_integer optimization_level{};
+    std::shared_ptr<unreachable_units> unreachable{ std::make_shared<unreachable_units>() };
   };
 }
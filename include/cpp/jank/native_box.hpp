@@ -3,6 +3,9 @@
 #include <fmt/ostream.h>
 
 #include <jank/runtime/object.hpp>
+#include <jank/detail/gc_layout.hpp>
+#include <jank/profile/alloc.hpp>
+#include <jank/util/arena.hpp>
 
 namespace jank
 {
@@ -237,19 +240,47 @@ namespace jank
   native_box<T> make_box(Args &&...args)
   {
     native_box<T> ret;
-    if constexpr(T::pointer_free)
-    {
-      ret = new(PointerFreeGC) T{ std::forward<Args>(args)... };
+    if constexpr(requires { requires T::arena_allocated; })
+    {
+      if(auto * const a = util::arena::current())
+      {
+        ret = ::new(a->allocate(sizeof(T), alignof(T))) T{ std::forward<Args>(args)... };
+      }
+      else
+      {
+        ret = new(detail::gc_placement<T>()) T{ std::forward<Args>(args)... };
+      }
+    }
+    else if constexpr(detail::gc_described<T>)
+    {
+      auto * const mem(GC_malloc_explicitly_typed(sizeof(T), detail::gc_layout<T>::descriptor()));
+      if(!mem)
+      {
+        throw std::runtime_error{ "unable to allocate box" };
+      }
+      ret = ::new(mem) T{ std::forward<Args>(args)... };
     }
     else
     {
-      ret = new(GC) T{ std::forward<Args>(args)... };
+      ret = new(detail::gc_placement<T>()) T{ std::forward<Args>(args)... };
     }
 
     if(!ret)
     {
       throw std::runtime_error{ "unable to allocate box" };
     }
+
+    if(profile::alloc_sampling) [[unlikely]]
+    {
+      if constexpr(requires { ret->base.type; })
+      {
+        profile::count_allocation(ret->base.type, sizeof(T));
+      }
+      else
+      {
+        profile::count_allocation("native", sizeof(T));
+      }
+    }
     return ret;
   }
 
@@ -262,34 +293,49 @@ namespace jank
   template <typename T, size_t N>
   constexpr native_box<T> make_array_box()
   {
-    auto const ret(new(GC) T[N]{});
+    auto const ret(new(detail::gc_placement<T>()) T[N]{});
     if(!ret)
     {
       throw std::runtime_error{ "unable to allocate array box" };
     }
+
+    if(profile::alloc_sampling) [[unlikely]]
+    {
+      profile::count_allocation("array", N * sizeof(T));
+    }
     return ret;
   }
 
   template <typename T>
   constexpr native_box<T> make_array_box(size_t const length)
   {
-    auto const ret(new(GC) T[length]{});
+    auto const ret(new(detail::gc_placement<T>()) T[length]{});
     if(!ret)
     {
       throw std::runtime_error{ "unable to allocate array box" };
     }
+
+    if(profile::alloc_sampling) [[unlikely]]
+    {
+      profile::count_allocation("array", length * sizeof(T));
+    }
     return ret;
   }
 
   template <typename T, typename... Args>
   native_box<T> make_array_box(Args &&...args)
   {
-    /* TODO: pointer_free? */
-    auto const ret(new(GC) T[sizeof...(Args)]{ std::forward<Args>(args)... });
+    auto const ret(
+      new(detail::gc_placement<T>()) T[sizeof...(Args)]{ std::forward<Args>(args)... });
     if(!ret)
     {
       throw std::runtime_error{ "unable to allocate array box" };
     }
+
+    if(profile::alloc_sampling) [[unlikely]]
+    {
+      profile::count_allocation("array", sizeof...(Args) * sizeof(T));
+    }
     return ret;
   }
 
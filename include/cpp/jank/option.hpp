@@ -63,21 +63,21 @@ namespace jank
     template <typename D>
     constexpr option(option<D> const &o,
                      std::enable_if_t<std::is_constructible_v<T, D>> * = nullptr)
-      : set{ o.set }
+      : set{ o.is_some() }
     {
       if(set)
       {
-        new(reinterpret_cast<T *>(data)) T{ *reinterpret_cast<D const *>(o.data) };
+        new(reinterpret_cast<T *>(data)) T{ o.unwrap() };
       }
     }
 
     template <typename D>
     constexpr option(option<D> &&o, std::enable_if_t<std::is_constructible_v<T, D>> * = nullptr)
-      : set{ std::move(o.set) }
+      : set{ o.is_some() }
     {
       if(set)
       {
-        new(reinterpret_cast<T *>(data)) T{ std::move(*reinterpret_cast<D *>(o.data)) };
+        new(reinterpret_cast<T *>(data)) T{ std::move(o.unwrap()) };
       }
       o.reset();
     }
@@ -226,6 +226,162 @@ namespace jank
     native_bool set{};
   };
 
+  template <typename T>
+  struct native_box;
+
+  /* A box which has been set is never null, so null can stand in for none. This keeps an
+   * option of a box, like every object's meta, to a single word, rather than a word and a
+   * flag padded out to another. The API is the same as above, so callers can't tell. */
+  template <typename T>
+  struct option<native_box<T>>
+  {
+    using value_type = native_box<T>;
+
+    constexpr option() = default;
+    constexpr option(option const &) = default;
+
+    constexpr option(option &&o) noexcept
+      : data{ o.data }
+    {
+      o.reset();
+    }
+
+    template <typename D = value_type>
+    constexpr option(
+      D &&d,
+      std::enable_if_t<std::is_constructible_v<value_type, D>
+                       && !std::is_same_v<std::decay_t<D>, option<value_type>>> * = nullptr)
+      : data{ std::forward<D>(d) }
+    {
+    }
+
+    template <typename D>
+    constexpr option(option<D> const &o,
+                     std::enable_if_t<std::is_constructible_v<value_type, D>> * = nullptr)
+    {
+      if(o.is_some())
+      {
+        data = value_type{ o.unwrap() };
+      }
+    }
+
+    template <typename D>
+    constexpr option(option<D> &&o,
+                     std::enable_if_t<std::is_constructible_v<value_type, D>> * = nullptr)
+    {
+      if(o.is_some())
+      {
+        data = value_type{ std::move(o.unwrap()) };
+      }
+      o.reset();
+    }
+
+    constexpr option(none_t const &)
+    {
+    }
+
+    constexpr option &operator=(option const &rhs) = default;
+
+    constexpr option &operator=(option &&rhs) noexcept
+    {
+      if(this == &rhs)
+      {
+        return *this;
+      }
+      data = rhs.data;
+      rhs.reset();
+      return *this;
+    }
+
+    constexpr option &operator=(none_t const &)
+    {
+      reset();
+      return *this;
+    }
+
+    template <typename D>
+    // NOLINTNEXTLINE(cppcoreguidelines-c-copy-assignment-signature): It gets this wrong.
+    constexpr std::enable_if_t<std::is_constructible_v<value_type, D>, option &> operator=(D &&rhs)
+    {
+      data = value_type{ std::forward<D>(rhs) };
+      return *this;
+    }
+
+    constexpr void reset() noexcept
+    {
+      data = nullptr;
+    }
+
+    constexpr native_bool is_some() const
+    {
+      return data != nullptr;
+    }
+
+    constexpr native_bool is_none() const
+    {
+      return data == nullptr;
+    }
+
+    constexpr value_type &unwrap()
+    {
+      /* TODO: Panic fn. */
+      assert(is_some());
+      return data;
+    }
+
+    constexpr value_type const &unwrap() const
+    {
+      /* TODO: Panic fn. */
+      assert(is_some());
+      return data;
+    }
+
+    constexpr value_type &unwrap_or(value_type &fallback)
+    {
+      if(is_some())
+      {
+        return data;
+      }
+      return fallback;
+    }
+
+    constexpr value_type unwrap_or(value_type fallback) const
+    {
+      if(is_some())
+      {
+        return data;
+      }
+      return fallback;
+    }
+
+    constexpr native_bool operator!=(option const &rhs) const
+    {
+      return data != rhs.data;
+    }
+
+    constexpr native_bool operator==(option const &rhs) const
+    {
+      return data == rhs.data;
+    }
+
+    constexpr native_bool operator!=(value_type const &rhs) const
+    {
+      return is_none() || data != rhs;
+    }
+
+    constexpr native_bool operator==(value_type const &rhs) const
+    {
+      return !(*this != rhs);
+    }
+
+    constexpr operator native_bool() const
+    {
+      return is_some();
+    }
+
+    value_type data;
+  };
+
   template <typename T, typename Decayed = std::decay_t<T>>
   option<Decayed> some(T &&t)
   {
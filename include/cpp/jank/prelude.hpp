@@ -26,6 +26,9 @@
 #include <jank/runtime/math.hpp>
 #include <jank/runtime/util.hpp>
 #include <jank/runtime/seq.hpp>
+#include <jank/runtime/call_site_cache.hpp>
+#include <jank/runtime/protocol.hpp>
+#include <jank/runtime/multi_fn.hpp>
 #include <jank/runtime/behavior/numberable.hpp>
 #include <jank/runtime/behavior/nameable.hpp>
 #include <jank/runtime/behavior/transientable.hpp>
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace jank::runtime
+{
+  enum class object_type : uint8_t;
+}
+
+namespace jank::util::cli
+{
+  struct options;
+}
+
+/* This is included by jank/type.hpp, so that native_allocator can count its allocations,
+ * which means it needs to stay free of everything else jank. */
+namespace jank::profile
+{
+  /* Set once, at start up. Every allocation path checks this first, so sampling costs a
+   * single branch when it's disabled. */
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+  extern bool alloc_sampling;
+
+  /* While sampling, each jank fn call puts one of these on the stack for its duration. Each
+   * one points to the one before it, so together they're the stack of jank fns, which we use
+   * to attribute each sample. The name is the site ID; codegen gives us a string literal, so
+   * pushing a scope is just a couple of pointer writes. */
+  struct alloc_scope
+  {
+    alloc_scope() = delete;
+    alloc_scope(char const *name);
+    alloc_scope(alloc_scope const &) = delete;
+    alloc_scope(alloc_scope &&) = delete;
+    ~alloc_scope();
+
+    char const *name{};
+    alloc_scope const *previous{};
+  };
+
+  /* Every Nth allocation is recorded, against the current stack of jank fns. */
+  void count_allocation(runtime::object_type type, size_t size);
+  void count_allocation(std::string_view const &label, size_t size);
+
+  void configure_alloc(util::cli::options const &opts);
+  /* Writes the samples so far as folded stacks, which flame graph tools can read directly.
+   * This happens at exit and, after a SIGUSR2, on the next sampled allocation. */
+  void dump_allocations();
+}
@@ -8,6 +8,9 @@ namespace jank::profile
   void enter(native_persistent_string_view const &region);
   void exit(native_persistent_string_view const &region);
   void report(native_persistent_string_view const &boundary);
+  /* GC and JIT totals. These are written once, when the profile is closed at exit, since
+   * gathering the GC stats takes the GC's lock. This can also be called any time before. */
+  void report_summary();
 
   struct timer
   {
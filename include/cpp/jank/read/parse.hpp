@@ -3,6 +3,7 @@
 #include <jank/result.hpp>
 #include <jank/option.hpp>
 #include <jank/read/lex.hpp>
+#include <jank/runtime/obj/persistent_string.hpp>
 
 namespace jank::runtime
 {
@@ -82,6 +83,9 @@ namespace jank::read::parse
     iterator end();
 
   private:
+    /* Interns the string, if the context is set to, for all string literals. */
+    runtime::obj::persistent_string_ptr make_string(native_persistent_string const &s) const;
+
     string_result<runtime::object_ptr> syntax_quote(runtime::object_ptr form);
     string_result<runtime::object_ptr> syntax_quote_expand_seq(runtime::object_ptr seq);
     static string_result<runtime::object_ptr> syntax_quote_flatten_map(runtime::object_ptr seq);
@@ -87,7 +87,18 @@ namespace jank::runtime
                           object_ptr,
                           obj::persistent_list_ptr);
 
+  /* Like Clojure's `apply`, with any leading args given separately, so they don't need
+   * to be consed onto the seq of args. */
   object_ptr apply_to(object_ptr source, object_ptr args);
+  object_ptr apply_to(object_ptr source, object_ptr a1, object_ptr args);
+  object_ptr apply_to(object_ptr source, object_ptr a1, object_ptr a2, object_ptr args);
+  object_ptr
+  apply_to(object_ptr source, object_ptr a1, object_ptr a2, object_ptr a3, object_ptr args);
+
+  /* Rest args are passed to variadic arities as a seq over the caller's stack, which is
+   * only valid for the duration of the call. A variadic arity which lets its rest args
+   * escape calls this on entry to get a copy on the heap. Anything else is returned as is. */
+  object_ptr materialize_rest(object_ptr rest);
 
   namespace behavior
   {
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <typeinfo>
+
+#include <jank/runtime/erasure.hpp>
+
+namespace jank::runtime
+{
+  /* Bumped whenever JIT compiled code is unloaded, since the type info of an unloaded fn can
+   * then be reused, at the same address, by a different one. */
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+  extern std::atomic<uint32_t> code_epoch;
+
+  /* Codegen gives each dynamic call site one of these, as a polymorphic inline cache. Going
+   * through `dynamic_call` means a type switch, a virtual call to get the arity flags, and
+   * then decoding them, every time. Most call sites only ever see a handful of different fns,
+   * though, like the fn given to `reduce`, so we remember the dynamic types of the last few
+   * callables for which this site's args map straight onto a `call` overload. A hit is then
+   * just a single virtual call.
+   *
+   * Each entry is a single pointer, so threads racing on a site can only evict each other's
+   * entries; they can never see a half written one. All entries are dropped once any code is
+   * unloaded, per `code_epoch`. */
+  struct call_site_cache
+  {
+    static constexpr size_t entry_count{ 4 };
+
+    template <typename... Args>
+    [[gnu::always_inline, gnu::flatten, gnu::hot]]
+    object_ptr call(object_ptr const source, Args const... args)
+    {
+      static_assert(sizeof...(Args) <= max_params);
+
+      auto const * const c(to_callable(source));
+      if(!c)
+      {
+        return dynamic_call(source, args...);
+      }
+
+      auto const epoch(code_epoch.load(std::memory_order_relaxed));
+      if(seen_epoch.load(std::memory_order_relaxed) != epoch)
+      {
+        for(auto &entry : entries)
+        {
+          entry.store(nullptr, std::memory_order_relaxed);
+        }
+        seen_epoch.store(epoch, std::memory_order_relaxed);
+      }
+
+      auto const * const type(&typeid(*c));
+      for(auto const &entry : entries)
+      {
+        if(entry.load(std::memory_order_relaxed) == type)
+        {
+          return c->call(args...);
+        }
+      }
+
+      if(!is_direct(c->get_arity_flags(), sizeof...(Args)))
+      {
+        return dynamic_call(source, args...);
+      }
+
+      auto const slot(next_entry.fetch_add(1, std::memory_order_relaxed) % entry_count);
+      entries[slot].store(type, std::memory_order_relaxed);
+      return c->call(args...);
+    }
+
+    static behavior::callable const *to_callable(object_ptr const source)
+    {
+      switch(source->type)
+      {
+        case object_type::jit_function:
+          return expect_object<obj::jit_function>(source).data;
+        case object_type::native_function_wrapper:
+          return expect_object<obj::native_function_wrapper>(source).data;
+        default:
+          return nullptr;
+      }
+    }
+
+    /* Whether `dynamic_call` would end up calling the fixed overload for this many args, rather
+     * than packing some of them up for a variadic arity. */
+    static constexpr native_bool
+    is_direct(behavior::callable::arity_flag_t const arity_flags, size_t const arg_count)
+    {
+      if(!(arity_flags & behavior::callable::mask_variadic_arity(0)))
+      {
+        return true;
+      }
+
+      size_t const required_args(arity_flags & 0b00111111);
+      return arg_count < required_args
+        || (arg_count == required_args && behavior::callable::is_variadic_ambiguous(arity_flags));
+    }
+
+    std::atomic<std::type_info const *> entries[entry_count]{};
+    std::atomic<uint8_t> next_entry{};
+    std::atomic<uint32_t> seen_epoch{};
+  };
+}
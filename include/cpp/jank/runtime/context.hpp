@@ -10,8 +10,12 @@
 #include <jank/runtime/module/loader.hpp>
 #include <jank/runtime/ns.hpp>
 #include <jank/runtime/var.hpp>
+#include <jank/runtime/weak_table.hpp>
+#include <jank/runtime/erasure.hpp>
 #include <jank/runtime/obj/keyword.hpp>
+#include <jank/runtime/obj/native_function_wrapper.hpp>
 #include <jank/jit/processor.hpp>
+#include <jank/util/arena.hpp>
 #include <jank/util/cli.hpp>
 
 namespace jank::jit
@@ -52,6 +56,18 @@ namespace jank::runtime
     option<var_ptr>
     find_var(native_persistent_string const &ns, native_persistent_string const &name);
 
+    /* C++ libraries can expose their fns to jank in bulk, using this. Each one is bound to a
+     * var in the given ns, which is created if needed. Multiple arities of the same fn can
+     * be given together. */
+    struct native_fn
+    {
+      native_persistent_string name;
+      obj::detail::function_type fn;
+    };
+
+    ns_ptr intern_native_fns(native_persistent_string const &ns,
+                             std::initializer_list<native_fn> const fns);
+
     result<obj::keyword_ptr, native_persistent_string>
     intern_keyword(native_persistent_string_view const &ns,
                    native_persistent_string_view const &name,
@@ -59,6 +75,33 @@ namespace jank::runtime
     result<obj::keyword_ptr, native_persistent_string>
     intern_keyword(native_persistent_string_view const &s);
 
+    /* Codegen puts each lifted constant through here once per module load, so every fn,
+     * in every ns, which uses the same literal shares one object. Constants are only shared
+     * when nothing could tell them apart, which includes their type and meta, all the way
+     * down. The pool holds them weakly, so a constant goes away with the last code using it. */
+    object_ptr intern_constant(object_ptr o);
+
+    template <typename T>
+    native_box<T> intern_constant(native_box<T> const o)
+    {
+      return expect_object<T>(intern_constant(object_ptr{ o }));
+    }
+
+    /* Local fns are constructed every time their enclosing fn runs, so codegen keeps their
+     * constants in function statics, which are initialized once. JIT compiled memory isn't
+     * scanned by the GC, so the constant is held in an uncollectable cell instead. The code
+     * of local fns is never unloaded, so the cell is never freed. */
+    template <typename T>
+    native_box<T> const &intern_static_constant(native_box<T> const o)
+    {
+      auto * const cell(GC_MALLOC_UNCOLLECTABLE(sizeof(native_box<T>)));
+      if(!cell)
+      {
+        throw std::runtime_error{ "unable to allocate constant" };
+      }
+      return *new(cell) native_box<T>{ intern_constant(o) };
+    }
+
     object_ptr macroexpand1(object_ptr o);
     object_ptr macroexpand(object_ptr o);
 
@@ -68,6 +111,8 @@ namespace jank::runtime
 
     object_ptr eval_file(native_persistent_string_view const &path);
     object_ptr eval_string(native_persistent_string_view const &code);
+    /* Unlike eval_string, the expressions are handed back, so they can't come from an arena
+     * which is released when we return. They're kept in analysis_arena instead. */
     native_vector<analyze::expression_ptr>
     analyze_string(native_persistent_string_view const &code, native_bool const eval = true);
 
@@ -100,6 +145,8 @@ namespace jank::runtime
 
     folly::Synchronized<native_unordered_map<obj::symbol_ptr, ns_ptr>> namespaces;
     folly::Synchronized<native_unordered_map<native_persistent_string, obj::keyword_ptr>> keywords;
+    /* Keyed by hash, so each bucket holds the constants which collide. */
+    folly::Synchronized<weak_table> constants;
 
     struct binding_scope
     {
@@ -122,12 +169,32 @@ namespace jank::runtime
     /* TODO: This needs to be synchronized. */
     analyze::processor an_prc{ *this };
     jit::processor jit_prc;
+    /* Holds the expressions from analyze_string for as long as this context lives. */
+    /* TODO: This needs to be synchronized. */
+    util::arena analysis_arena;
     /* TODO: This needs to be a dynamic var. */
     native_unordered_map<native_persistent_string, native_vector<native_persistent_string>>
       module_dependencies;
     native_persistent_string output_dir;
     module::loader module_loader;
 
+    /* With direct linking, calls to fns which were defined in compiled namespaces skip the
+     * var and go straight to the generated struct's `call`. Vars marked `^:redef` opt out,
+     * so they can still be rebound at the REPL. */
+    struct direct_link_target
+    {
+      /* Fully qualified C++ name of the fn's generated struct. */
+      native_persistent_string native_type;
+      /* Only fixed arities can be linked; variadic calls still need dispatch. */
+      native_set<size_t> arities;
+    };
+
+    native_bool direct_linking{};
+    native_unordered_map<var_ptr, direct_link_target> direct_link_targets;
+
+    /* Whether the reader interns string literals. See `intern_string`. */
+    native_bool intern_strings{};
+
     var_ptr current_ns_var{};
     var_ptr in_ns_var{};
     var_ptr compile_files_var{};
@@ -19,6 +19,7 @@
 #include <jank/runtime/obj/transient_hash_map.hpp>
 #include <jank/runtime/obj/transient_vector.hpp>
 #include <jank/runtime/obj/transient_set.hpp>
+#include <jank/runtime/obj/transient_string.hpp>
 #include <jank/runtime/obj/iterator.hpp>
 #include <jank/runtime/obj/range.hpp>
 #include <jank/runtime/obj/jit_function.hpp>
@@ -196,6 +197,11 @@ namespace jank::runtime
           return fn(expect_object<obj::transient_set>(erased), std::forward<Args>(args)...);
         }
         break;
+      case object_type::transient_string:
+        {
+          return fn(expect_object<obj::transient_string>(erased), std::forward<Args>(args)...);
+        }
+        break;
       case object_type::cons:
         {
           return fn(expect_object<obj::cons>(erased), std::forward<Args>(args)...);
@@ -397,4 +403,18 @@ namespace jank::runtime
         return else_fn();
     }
   }
+
+  /* Direct linking holds onto the generated struct of the fn a var is bound to. The var
+   * may have been rebound to something else by the time we link, in which case this is
+   * null and the caller needs to go through the var. */
+  template <typename T>
+  T *direct_link(var_ptr const v)
+  {
+    auto const root(v->get_root());
+    if(root->type != object_type::jit_function)
+    {
+      return nullptr;
+    }
+    return dynamic_cast<T *>(expect_object<obj::jit_function>(root).data);
+  }
 }
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <jank/runtime/obj/jit_function.hpp>
+#include <jank/util/cli.hpp>
+
+namespace jank::runtime
+{
+  struct context;
+
+  /* A snapshot of what the GC has been doing. Sizes are in bytes and pauses are in
+   * nanoseconds. Pause percentiles only cover the last `pause_window` collections. */
+  struct gc_stats
+  {
+    static constexpr size_t pause_window{ 256 };
+
+    /* A map of keywords, like {:heap-size 1024 ...}, for `jank.gc/stats`. */
+    object_ptr to_object(context &rt_ctx) const;
+
+    size_t heap_size{};
+    size_t free_bytes{};
+    size_t unmapped_bytes{};
+    size_t bytes_since_gc{};
+    /* Everything allocated since start up, not including bytes_since_gc. */
+    size_t total_bytes{};
+    size_t collections{};
+    size_t free_space_divisor{};
+    native_real free_ratio{};
+
+    /* Each collection is timed from start to end. In incremental mode, that's spread over a
+     * number of smaller pauses, so these are an upper bound. */
+    native_integer last_pause{};
+    native_integer p50_pause{};
+    native_integer p90_pause{};
+    native_integer p99_pause{};
+    native_integer max_pause{};
+  };
+
+  gc_stats current_gc_stats();
+
+  /* Applies the GC tuning options, initializes the GC, and starts timing collections. The
+   * number of markers can only be set before the GC is initialized, so this should be called
+   * before anything is allocated. */
+  void configure_gc(util::cli::options const &opts);
+
+  /* Binds the `jank.gc` fns: `stats`, which returns `gc_stats` as a map, and `collect`,
+   * which runs a full collection. */
+  void intern_gc_fns(context &rt_ctx);
+
+  /* `jank.gc/stats` needs the context to intern its keywords, so it can't be a plain native
+   * fn. */
+  struct gc_stats_fn : obj::jit_function
+  {
+    gc_stats_fn() = delete;
+    gc_stats_fn(context &rt_ctx);
+
+    object_ptr call() const final;
+
+    context &rt_ctx;
+  };
+}
@@ -207,10 +207,26 @@ namespace jank::runtime
 
   object_ptr rem(object_ptr l, object_ptr r);
   object_ptr inc(object_ptr l);
+  native_integer inc(obj::integer_ptr l);
+  native_real inc(obj::real_ptr l);
+  native_integer inc(native_integer l);
+  native_real inc(native_real l);
+
   object_ptr dec(object_ptr l);
+  native_integer dec(obj::integer_ptr l);
+  native_real dec(obj::real_ptr l);
+  native_integer dec(native_integer l);
+  native_real dec(native_real l);
+
   native_bool is_zero(object_ptr l);
+  native_bool is_zero(native_integer l);
+  native_bool is_zero(native_real l);
   native_bool is_pos(object_ptr l);
+  native_bool is_pos(native_integer l);
+  native_bool is_pos(native_real l);
   native_bool is_neg(object_ptr l);
+  native_bool is_neg(native_integer l);
+  native_bool is_neg(native_real l);
 
   native_real rand();
 
@@ -219,4 +235,14 @@ namespace jank::runtime
   native_integer to_int(obj::real_ptr l);
   native_integer to_int(native_integer l);
   native_integer to_int(native_real l);
+
+  /* Unboxed loop locals keep the same native type for the whole loop, so recur needs to
+   * convert its args back to that type. Unlike to_int, reals are never truncated into
+   * integer locals; that's an error. */
+  native_integer unbox_integer(object_ptr o);
+  native_integer unbox_integer(native_integer o);
+  native_integer unbox_integer(native_real o);
+  native_real unbox_real(object_ptr o);
+  native_real unbox_real(native_integer o);
+  native_real unbox_real(native_real o);
 }
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <atomic>
+#include <mutex>
+
+#include <jank/runtime/obj/jit_function.hpp>
+#include <jank/runtime/obj/persistent_hash_map.hpp>
+#include <jank/runtime/call_site_cache.hpp>
+#include <jank/runtime/var.hpp>
+
+namespace jank::runtime
+{
+  /* A multimethod calls its dispatch fn on the args and then calls the method for the
+   * resulting dispatch value. Finding that method means checking every entry of the method
+   * table with `isa?` and settling ties with the preferences, which is slow, so we cache the
+   * result per dispatch value. The cache is a persistent map behind an atomic pointer, so
+   * readers never lock and a hit is a single hash lookup. Misses lock and swap in a new map.
+   *
+   * The cache is dropped whenever methods or preferences change, or whenever the hierarchy
+   * var is no longer bound to the hierarchy which the cache was built against. The actual
+   * resolution is done by a jank fn, so it can share `isa?` with everything else. */
+  struct multi_fn : obj::jit_function
+  {
+    multi_fn() = delete;
+    multi_fn(native_persistent_string const &name,
+             object_ptr dispatch_fn,
+             object_ptr default_value,
+             var_ptr hierarchy,
+             object_ptr resolve_fn);
+
+    void add_method(object_ptr dispatch_value, object_ptr method);
+    void remove_method(object_ptr dispatch_value);
+    void prefer_method(object_ptr preferred, object_ptr other);
+
+    object_ptr find_method(object_ptr dispatch_value) const;
+    /* Expects the mutex to be held. */
+    void reset_cache(object_ptr hierarchy_value) const;
+
+    object_ptr call() const final;
+    object_ptr call(object_ptr) const final;
+    object_ptr call(object_ptr, object_ptr) const final;
+    object_ptr call(object_ptr, object_ptr, object_ptr) const final;
+    object_ptr call(object_ptr, object_ptr, object_ptr, object_ptr) const final;
+    object_ptr call(object_ptr, object_ptr, object_ptr, object_ptr, object_ptr) const final;
+    object_ptr
+      call(object_ptr, object_ptr, object_ptr, object_ptr, object_ptr, object_ptr) const final;
+    object_ptr
+      call(object_ptr, object_ptr, object_ptr, object_ptr, object_ptr, object_ptr, object_ptr)
+        const final;
+    object_ptr call(object_ptr,
+                    object_ptr,
+                    object_ptr,
+                    object_ptr,
+                    object_ptr,
+                    object_ptr,
+                    object_ptr,
+                    object_ptr) const final;
+    object_ptr call(object_ptr,
+                    object_ptr,
+                    object_ptr,
+                    object_ptr,
+                    object_ptr,
+                    object_ptr,
+                    object_ptr,
+                    object_ptr,
+                    object_ptr) const final;
+    object_ptr call(object_ptr,
+                    object_ptr,
+                    object_ptr,
+                    object_ptr,
+                    object_ptr,
+                    object_ptr,
+                    object_ptr,
+                    object_ptr,
+                    object_ptr,
+                    object_ptr) const final;
+
+    native_persistent_string name;
+    object_ptr dispatch_fn{};
+    object_ptr default_value{};
+    var_ptr hierarchy{};
+    /* Called as (resolve method-table prefer-table hierarchy dispatch-value default-value)
+     * on a cache miss. Returns nil if there's no method. */
+    object_ptr resolve_fn{};
+
+    /* These are only touched with the mutex held. */
+    obj::persistent_hash_map_ptr method_table{ obj::persistent_hash_map::empty() };
+    obj::persistent_hash_map_ptr prefer_table{ obj::persistent_hash_map::empty() };
+    mutable std::mutex mutex;
+
+    mutable std::atomic<obj::persistent_hash_map *> method_cache{};
+    mutable std::atomic<object *> cached_hierarchy{};
+    mutable call_site_cache dispatch_site;
+  };
+
+  using multi_fn_ptr = native_box<multi_fn>;
+
+  /* Multimethods are stored as plain fns, so this gets back the multimethod from one. */
+  native_bool is_multi_fn(object_ptr o);
+  multi_fn_ptr expect_multi_fn(object_ptr o);
+}
@@ -53,3 +53,12 @@ namespace jank::runtime
   using ns = static_object<object_type::ns>;
   using ns_ptr = native_box<ns>;
 }
+
+namespace jank::detail
+{
+  template <>
+  struct gc_layout<runtime::ns>
+    : gc_fields<runtime::ns, &runtime::ns::name, &runtime::ns::vars, &runtime::ns::aliases>
+  {
+  };
+}
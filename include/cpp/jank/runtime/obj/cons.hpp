@@ -37,9 +37,9 @@ namespace jank::runtime
     native_box<static_object> cons(object_ptr head) const;
 
     object base{ object_type::cons };
+    mutable native_hash hash{};
     object_ptr head{};
     object_ptr tail{};
-    mutable native_hash hash{};
   };
 
   namespace obj
@@ -48,3 +48,12 @@ namespace jank::runtime
     using cons_ptr = native_box<cons>;
   }
 }
+
+namespace jank::detail
+{
+  template <>
+  struct gc_layout<runtime::obj::cons>
+    : gc_fields<runtime::obj::cons, &runtime::obj::cons::head, &runtime::obj::cons::tail>
+  {
+  };
+}
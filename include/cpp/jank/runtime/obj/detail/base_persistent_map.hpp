@@ -132,7 +132,7 @@ namespace jank::runtime::obj::detail
     }
 
     object base{ OT };
-    option<object_ptr> meta;
     mutable native_hash hash{};
+    option<object_ptr> meta;
   };
 }
@@ -51,3 +51,16 @@ namespace jank::runtime
     using iterator_ptr = native_box<iterator>;
   }
 }
+
+namespace jank::detail
+{
+  template <>
+  struct gc_layout<runtime::obj::iterator>
+    : gc_fields<runtime::obj::iterator,
+                &runtime::obj::iterator::fn,
+                &runtime::obj::iterator::current,
+                &runtime::obj::iterator::previous,
+                &runtime::obj::iterator::cached_next>
+  {
+  };
+}
@@ -43,3 +43,14 @@ namespace jank::runtime
     using jit_function_ptr = native_box<jit_function>;
   }
 }
+
+namespace jank::detail
+{
+  template <>
+  struct gc_layout<runtime::obj::jit_function>
+    : gc_fields<runtime::obj::jit_function,
+                &runtime::obj::jit_function::data,
+                &runtime::obj::jit_function::meta>
+  {
+  };
+}
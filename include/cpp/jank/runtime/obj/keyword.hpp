@@ -15,7 +15,7 @@ namespace jank::runtime
   template <>
   struct static_object<object_type::keyword> : gc
   {
-    static constexpr native_bool pointer_free{ true };
+    static constexpr native_bool pointer_free{ false };
     /* Clojure uses this. No idea. https://github.com/clojure/clojure/blob/master/src/jvm/clojure/lang/Keyword.java */
     static constexpr size_t hash_magic{ 0x9e3779b9 };
 
@@ -86,3 +86,12 @@ namespace std
     }
   };
 }
+
+namespace jank::detail
+{
+  template <>
+  struct gc_layout<runtime::obj::keyword>
+    : gc_fields<runtime::obj::keyword, &runtime::obj::keyword::sym>
+  {
+  };
+}
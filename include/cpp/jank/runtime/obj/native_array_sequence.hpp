@@ -52,3 +52,12 @@ namespace jank::runtime
     using native_array_sequence_ptr = native_box<native_array_sequence>;
   }
 }
+
+namespace jank::detail
+{
+  template <>
+  struct gc_layout<runtime::obj::native_array_sequence>
+    : gc_fields<runtime::obj::native_array_sequence, &runtime::obj::native_array_sequence::arr>
+  {
+  };
+}
@@ -1,7 +1,7 @@
 #pragma once
 
 #include <iostream>
-#include <any>
+#include <array>
 
 #include <jank/runtime/behavior/callable.hpp>
 #include <jank/runtime/behavior/metadatable.hpp>
@@ -10,38 +10,43 @@ namespace jank::runtime
 {
   namespace obj::detail
   {
-    struct function_type
+    template <typename T>
+    struct is_native_fn : std::false_type
     {
-      template <typename T>
-      using value_type = std::function<T>;
+    };
 
-      function_type() = default;
+    template <typename... Args>
+    struct is_native_fn<object_ptr (*)(Args...)>
+      : std::bool_constant<(sizeof...(Args) <= max_params)
+                           && (std::same_as<Args, object_ptr> && ...)>
+    {
+    };
 
-      template <typename R, typename... Args>
-      function_type(R (* const f)(Args...))
-        : function_type{ value_type<R(Args...)>{ f } }
-      {
-      }
+    /* Native fns are plain C++ fn pointers which take and return object_ptr. Rather than
+     * erasing them behind std::function and std::any, which means a type check and an extra
+     * indirection on every call, we keep a pointer per arity. A call is then just an index
+     * and an indirect call. One wrapper can hold any number of arities of the same fn. */
+    struct function_type
+    {
+      using erased_fn = void (*)();
 
-      template <typename R, typename... Args>
-      function_type(value_type<R(Args...)> &&f)
-        : value{ std::move(f) }
-      {
-      }
+      function_type() = default;
 
-      template <typename R, typename... Args>
-      function_type(value_type<R(Args...)> const &f)
-        : value{ f }
+      template <typename... Fns>
+      requires(sizeof...(Fns) > 0 && (is_native_fn<Fns>::value && ...))
+      function_type(Fns const... fns)
       {
+        (set(fns), ...);
       }
 
-      template <typename F>
-      F const *get() const
+      template <typename... Args>
+      void set(object_ptr (* const f)(Args...))
       {
-        return std::any_cast<F>(&value);
+        /* Casting back to the original fn pointer type, before calling, is well defined. */
+        arities[sizeof...(Args)] = reinterpret_cast<erased_fn>(f);
       }
 
-      std::any value;
+      std::array<erased_fn, max_params + 1> arities{};
     };
   }
 
@@ -59,7 +64,7 @@ namespace jank::runtime
     : gc
     , behavior::callable
   {
-    static constexpr native_bool pointer_free{ true };
+    static constexpr native_bool pointer_free{ false };
 
     static_object() = default;
     static_object(static_object &&) = default;
@@ -155,3 +160,14 @@ namespace jank::runtime
     }
   }
 }
+
+namespace jank::detail
+{
+  template <>
+  struct gc_layout<runtime::obj::native_function_wrapper>
+    : gc_fields<runtime::obj::native_function_wrapper,
+                &runtime::obj::native_function_wrapper::data,
+                &runtime::obj::native_function_wrapper::meta>
+  {
+  };
+}
@@ -45,3 +45,12 @@ namespace jank::runtime
     using native_vector_sequence_ptr = native_box<native_vector_sequence>;
   }
 }
+
+namespace jank::detail
+{
+  template <>
+  struct gc_layout<runtime::obj::native_vector_sequence>
+    : gc_fields<runtime::obj::native_vector_sequence, &runtime::obj::native_vector_sequence::data>
+  {
+  };
+}
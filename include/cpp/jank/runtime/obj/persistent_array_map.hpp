@@ -86,3 +86,14 @@ namespace jank::runtime
     using persistent_array_map_ptr = native_box<persistent_array_map>;
   }
 }
+
+namespace jank::detail
+{
+  template <>
+  struct gc_layout<runtime::obj::persistent_array_map>
+    : gc_fields<runtime::obj::persistent_array_map,
+                &runtime::obj::persistent_array_map::data,
+                &runtime::obj::persistent_array_map::meta>
+  {
+  };
+}
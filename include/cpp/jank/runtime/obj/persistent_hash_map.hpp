@@ -100,3 +100,14 @@ namespace jank::runtime
     using persistent_hash_map_ptr = native_box<persistent_hash_map>;
   }
 }
+
+namespace jank::detail
+{
+  template <>
+  struct gc_layout<runtime::obj::persistent_hash_map>
+    : gc_fields<runtime::obj::persistent_hash_map,
+                &runtime::obj::persistent_hash_map::data,
+                &runtime::obj::persistent_hash_map::meta>
+  {
+  };
+}
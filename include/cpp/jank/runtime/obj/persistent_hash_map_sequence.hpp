@@ -19,3 +19,15 @@ namespace jank::runtime
     using persistent_hash_map_sequence_ptr = native_box<persistent_hash_map_sequence>;
   }
 }
+
+namespace jank::detail
+{
+  template <>
+  struct gc_layout<runtime::obj::persistent_hash_map_sequence>
+    : gc_fields<runtime::obj::persistent_hash_map_sequence,
+                &runtime::obj::persistent_hash_map_sequence::coll,
+                &runtime::obj::persistent_hash_map_sequence::begin,
+                &runtime::obj::persistent_hash_map_sequence::end>
+  {
+  };
+}
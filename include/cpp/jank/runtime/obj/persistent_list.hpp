@@ -72,3 +72,14 @@ namespace jank::runtime
     using persistent_list_ptr = native_box<persistent_list>;
   }
 }
+
+namespace jank::detail
+{
+  template <>
+  struct gc_layout<runtime::obj::persistent_list>
+    : gc_fields<runtime::obj::persistent_list,
+                &runtime::obj::persistent_list::data,
+                &runtime::obj::persistent_list::meta>
+  {
+  };
+}
@@ -36,3 +36,15 @@ namespace jank::runtime
     using persistent_list_sequence_ptr = native_box<persistent_list_sequence>;
   }
 }
+
+namespace jank::detail
+{
+  template <>
+  struct gc_layout<runtime::obj::persistent_list_sequence>
+    : gc_fields<runtime::obj::persistent_list_sequence,
+                &runtime::obj::persistent_list_sequence::coll,
+                &runtime::obj::persistent_list_sequence::begin,
+                &runtime::obj::persistent_list_sequence::end>
+  {
+  };
+}
@@ -81,3 +81,14 @@ namespace jank::runtime
   using persistent_set = static_object<object_type::persistent_set>;
   using persistent_set_ptr = native_box<persistent_set>;
 }
+
+namespace jank::detail
+{
+  template <>
+  struct gc_layout<runtime::obj::persistent_set>
+    : gc_fields<runtime::obj::persistent_set,
+                &runtime::obj::persistent_set::data,
+                &runtime::obj::persistent_set::meta>
+  {
+  };
+}
@@ -35,3 +35,15 @@ namespace jank::runtime
     using persistent_set_sequence_ptr = native_box<persistent_set_sequence>;
   }
 }
+
+namespace jank::detail
+{
+  template <>
+  struct gc_layout<runtime::obj::persistent_set_sequence>
+    : gc_fields<runtime::obj::persistent_set_sequence,
+                &runtime::obj::persistent_set_sequence::coll,
+                &runtime::obj::persistent_set_sequence::begin,
+                &runtime::obj::persistent_set_sequence::end>
+  {
+  };
+}
@@ -4,10 +4,18 @@
 
 namespace jank::runtime
 {
+  namespace obj
+  {
+    using transient_string = static_object<object_type::transient_string>;
+    using transient_string_ptr = native_box<transient_string>;
+  }
+
   /* TODO: Seqable. */
   template <>
   struct static_object<object_type::persistent_string> : gc
   {
+    using transient_type = static_object<object_type::transient_string>;
+
     static constexpr native_bool pointer_free{ false };
 
     static_object() = default;
@@ -41,6 +49,9 @@ namespace jank::runtime
     /* behavior::countable */
     size_t count() const;
 
+    /* behavior::transientable */
+    obj::transient_string_ptr to_transient() const;
+
     object base{ object_type::persistent_string };
     native_persistent_string data;
   };
@@ -51,3 +62,12 @@ namespace jank::runtime
     using persistent_string_ptr = native_box<persistent_string>;
   }
 }
+
+namespace jank::detail
+{
+  template <>
+  struct gc_layout<runtime::obj::persistent_string>
+    : gc_fields<runtime::obj::persistent_string, &runtime::obj::persistent_string::data>
+  {
+  };
+}
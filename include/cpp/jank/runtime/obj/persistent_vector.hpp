@@ -76,9 +76,9 @@ namespace jank::runtime
     obj::transient_vector_ptr to_transient() const;
 
     object base{ object_type::persistent_vector };
+    mutable native_hash hash{};
     value_type data;
     option<object_ptr> meta;
-    mutable native_hash hash{};
   };
 
   namespace obj
@@ -87,3 +87,14 @@ namespace jank::runtime
     using persistent_vector_ptr = native_box<persistent_vector>;
   }
 }
+
+namespace jank::detail
+{
+  template <>
+  struct gc_layout<runtime::obj::persistent_vector>
+    : gc_fields<runtime::obj::persistent_vector,
+                &runtime::obj::persistent_vector::data,
+                &runtime::obj::persistent_vector::meta>
+  {
+  };
+}
@@ -52,3 +52,13 @@ namespace jank::runtime
     using persistent_vector_sequence_ptr = native_box<persistent_vector_sequence>;
   }
 }
+
+namespace jank::detail
+{
+  template <>
+  struct gc_layout<runtime::obj::persistent_vector_sequence>
+    : gc_fields<runtime::obj::persistent_vector_sequence,
+                &runtime::obj::persistent_vector_sequence::vec>
+  {
+  };
+}
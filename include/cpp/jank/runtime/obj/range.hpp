@@ -49,3 +49,16 @@ namespace jank::runtime
     using range_ptr = native_box<range>;
   }
 }
+
+namespace jank::detail
+{
+  template <>
+  struct gc_layout<runtime::obj::range>
+    : gc_fields<runtime::obj::range,
+                &runtime::obj::range::start,
+                &runtime::obj::range::end,
+                &runtime::obj::range::step,
+                &runtime::obj::range::cached_next>
+  {
+  };
+}
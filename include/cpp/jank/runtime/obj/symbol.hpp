@@ -13,7 +13,7 @@ namespace jank::runtime
   template <>
   struct static_object<object_type::symbol> : gc
   {
-    static constexpr native_bool pointer_free{ true };
+    static constexpr native_bool pointer_free{ false };
 
     static_object() = default;
     static_object(static_object &&) = default;
@@ -52,13 +52,13 @@ namespace jank::runtime
     void set_name(native_persistent_string const &);
 
     object base{ object_type::symbol };
+    mutable native_hash hash{};
 
     /* These require mutation fns, since changing them will affect the hash. */
     native_persistent_string ns;
     native_persistent_string name;
 
     option<object_ptr> meta;
-    mutable native_hash hash{};
   };
 
   namespace obj
@@ -106,3 +106,15 @@ namespace std
     }
   };
 }
+
+namespace jank::detail
+{
+  template <>
+  struct gc_layout<runtime::obj::symbol>
+    : gc_fields<runtime::obj::symbol,
+                &runtime::obj::symbol::ns,
+                &runtime::obj::symbol::name,
+                &runtime::obj::symbol::meta>
+  {
+  };
+}
@@ -57,9 +57,9 @@ namespace jank::runtime
     void assert_active() const;
 
     object base{ object_type::transient_hash_map };
-    value_type data;
-    mutable native_hash hash{};
     native_bool active{ true };
+    mutable native_hash hash{};
+    value_type data;
   };
 
   namespace obj
@@ -68,3 +68,12 @@ namespace jank::runtime
     using transient_hash_map_ptr = native_box<transient_hash_map>;
   }
 }
+
+namespace jank::detail
+{
+  template <>
+  struct gc_layout<runtime::obj::transient_hash_map>
+    : gc_fields<runtime::obj::transient_hash_map, &runtime::obj::transient_hash_map::data>
+  {
+  };
+}
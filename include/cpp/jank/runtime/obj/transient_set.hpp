@@ -53,9 +53,9 @@ namespace jank::runtime
     void assert_active() const;
 
     object base{ object_type::transient_set };
-    value_type data;
-    mutable native_hash hash{};
     native_bool active{ true };
+    mutable native_hash hash{};
+    value_type data;
   };
 
   namespace obj
@@ -64,3 +64,12 @@ namespace jank::runtime
     using transient_set_ptr = native_box<transient_set>;
   }
 }
+
+namespace jank::detail
+{
+  template <>
+  struct gc_layout<runtime::obj::transient_set>
+    : gc_fields<runtime::obj::transient_set, &runtime::obj::transient_set::data>
+  {
+  };
+}
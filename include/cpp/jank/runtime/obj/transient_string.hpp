@@ -0,0 +1,61 @@
+#pragma once
+
+namespace jank::runtime
+{
+  /* A string builder. Each `conj!` appends the string form of its value, the same as `str`
+   * would, in amortized constant time, so building up a large string piece by piece is
+   * linear, rather than copying everything so far on each step. `persistent!` copies the
+   * result into a persistent string once, at the end.
+   *
+   * Unlike other transients, its string form is its contents, so `str` can read it without
+   * ending it. Equality and hashing are still based on identity. */
+  template <>
+  struct static_object<object_type::transient_string> : gc
+  {
+    static constexpr bool pointer_free{ false };
+
+    using value_type = native_vector<char>;
+    using persistent_type = static_object<object_type::persistent_string>;
+
+    static_object() = default;
+    static_object(static_object &&) noexcept = default;
+    static_object(static_object const &) = default;
+    static_object(native_persistent_string const &d);
+
+    /* behavior::objectable */
+    native_bool equal(object const &) const;
+    native_persistent_string to_string() const;
+    void to_string(fmt::memory_buffer &buff) const;
+    native_hash to_hash() const;
+
+    /* behavior::countable */
+    size_t count() const;
+
+    /* behavior::consable_in_place */
+    native_box<static_object> cons_in_place(object_ptr head);
+
+    /* behavior::persistentable */
+    native_box<persistent_type> to_persistent();
+
+    void assert_active() const;
+
+    object base{ object_type::transient_string };
+    native_bool active{ true };
+    value_type data;
+  };
+
+  namespace obj
+  {
+    using transient_string = static_object<object_type::transient_string>;
+    using transient_string_ptr = native_box<transient_string>;
+  }
+}
+
+namespace jank::detail
+{
+  template <>
+  struct gc_layout<runtime::obj::transient_string>
+    : gc_fields<runtime::obj::transient_string, &runtime::obj::transient_string::data>
+  {
+  };
+}
@@ -52,9 +52,9 @@ namespace jank::runtime
     void assert_active() const;
 
     object base{ object_type::transient_vector };
-    value_type data;
-    mutable native_hash hash{};
     native_bool active{ true };
+    mutable native_hash hash{};
+    value_type data;
   };
 
   namespace obj
@@ -63,3 +63,12 @@ namespace jank::runtime
     using transient_vector_ptr = native_box<transient_vector>;
   }
 }
+
+namespace jank::detail
+{
+  template <>
+  struct gc_layout<runtime::obj::transient_vector>
+    : gc_fields<runtime::obj::transient_vector, &runtime::obj::transient_vector::data>
+  {
+  };
+}
@@ -1,13 +1,14 @@
 #pragma once
 
 #include <concepts>
+#include <cstdint>
 
 #include <fmt/format.h>
 
 /* TODO: Move to obj namespace */
 namespace jank::runtime
 {
-  enum class object_type
+  enum class object_type : uint8_t
   {
     nil = 1,
     boolean,
@@ -25,6 +26,7 @@ namespace jank::runtime
     transient_hash_map,
     transient_set,
     transient_vector,
+    transient_string,
     persistent_set,
     cons,
     range,
@@ -41,6 +43,9 @@ namespace jank::runtime
     var_thread_binding,
   };
 
+  /* Every object starts with this header, which is a single byte. Objects put their small
+   * fields, like a cached hash or a flag, right after it, so they share its word rather than
+   * each being padded out to one of their own. */
   struct object
   {
     object_type type{};
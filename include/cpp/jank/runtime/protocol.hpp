@@ -0,0 +1,89 @@
+#pragma once
+
+#include <array>
+
+#include <magic_enum.hpp>
+
+#include <jank/runtime/obj/jit_function.hpp>
+
+namespace jank::runtime
+{
+  /* Each protocol method is a fn which dispatches on the type of its first arg. It owns a
+   * table with a slot per object type, so finding the impl is a single array load. From
+   * there, impls without a variadic arity are called into directly, which is the same
+   * virtual call a call site cache makes on a hit. Types which haven't been extended fall
+   * back to the default impl, if there is one.
+   *
+   * Since this is a jit_function, call sites see it like any other fn, inline caches and
+   * all. */
+  struct protocol_method : obj::jit_function
+  {
+    struct impl
+    {
+      object_ptr fn{};
+      /* Only set if every arity of the fn is fixed, so we can skip `dynamic_call`. */
+      behavior::callable const *direct{};
+    };
+
+    protocol_method() = delete;
+    protocol_method(native_persistent_string const &name);
+
+    /* A nil type extends the default impl. */
+    void extend(option<object_type> const &type, object_ptr fn);
+    native_bool is_extended(object_type type) const;
+
+    impl const &find_impl(object_ptr o) const;
+
+    object_ptr call(object_ptr) const final;
+    object_ptr call(object_ptr, object_ptr) const final;
+    object_ptr call(object_ptr, object_ptr, object_ptr) const final;
+    object_ptr call(object_ptr, object_ptr, object_ptr, object_ptr) const final;
+    object_ptr call(object_ptr, object_ptr, object_ptr, object_ptr, object_ptr) const final;
+    object_ptr
+      call(object_ptr, object_ptr, object_ptr, object_ptr, object_ptr, object_ptr) const final;
+    object_ptr
+      call(object_ptr, object_ptr, object_ptr, object_ptr, object_ptr, object_ptr, object_ptr)
+        const final;
+    object_ptr call(object_ptr,
+                    object_ptr,
+                    object_ptr,
+                    object_ptr,
+                    object_ptr,
+                    object_ptr,
+                    object_ptr,
+                    object_ptr) const final;
+    object_ptr call(object_ptr,
+                    object_ptr,
+                    object_ptr,
+                    object_ptr,
+                    object_ptr,
+                    object_ptr,
+                    object_ptr,
+                    object_ptr,
+                    object_ptr) const final;
+    object_ptr call(object_ptr,
+                    object_ptr,
+                    object_ptr,
+                    object_ptr,
+                    object_ptr,
+                    object_ptr,
+                    object_ptr,
+                    object_ptr,
+                    object_ptr,
+                    object_ptr) const final;
+
+    native_persistent_string name;
+    /* Object types start at 1, so slot 0 is unused. */
+    std::array<impl, magic_enum::enum_count<object_type>() + 1> impls{};
+    impl default_impl{};
+  };
+
+  using protocol_method_ptr = native_box<protocol_method>;
+
+  /* Protocol methods are stored as plain fns, so this gets back the method from one. */
+  protocol_method_ptr expect_protocol_method(object_ptr o);
+
+  /* Protocol types are named by keywords or symbols, like `:persistent-vector`, which map to
+   * object types. `:default` names the default impl. */
+  option<object_type> protocol_type(object_ptr type_name);
+}
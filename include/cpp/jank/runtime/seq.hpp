@@ -5,6 +5,12 @@
 
 namespace jank::runtime
 {
+  namespace obj
+  {
+    using keyword = static_object<object_type::keyword>;
+    using keyword_ptr = native_box<keyword>;
+  }
+
   namespace detail
   {
     size_t sequence_length(object_ptr const s);
@@ -85,11 +91,17 @@ namespace jank::runtime
   object_ptr second(object_ptr s);
   object_ptr next(object_ptr s);
   object_ptr next_in_place(object_ptr s);
+  native_integer count(object_ptr s);
+  object_ptr nth(object_ptr o, object_ptr index);
+  object_ptr nth(object_ptr o, object_ptr index, object_ptr fallback);
   object_ptr conj(object_ptr s, object_ptr o);
   object_ptr assoc(object_ptr m, object_ptr k, object_ptr v);
   object_ptr get(object_ptr m, object_ptr key);
   object_ptr get(object_ptr m, object_ptr key, object_ptr fallback);
   object_ptr get_in(object_ptr m, object_ptr keys);
+  /* Calls to keyword literals, like `(:k m)`, are compiled to these. */
+  object_ptr keyword_get(obj::keyword_ptr k, object_ptr m);
+  object_ptr keyword_get(obj::keyword_ptr k, object_ptr m, object_ptr fallback);
   object_ptr get_in(object_ptr m, object_ptr keys, object_ptr fallback);
   object_ptr find(object_ptr s, object_ptr key);
   native_bool contains(object_ptr s, object_ptr key);
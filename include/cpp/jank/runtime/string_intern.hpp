@@ -0,0 +1,23 @@
+#pragma once
+
+#include <jank/runtime/obj/persistent_string.hpp>
+
+namespace jank::runtime
+{
+  /* Returns the one live string object with the given contents, creating it if needed, so
+   * that repeated strings, like map keys read from input, share one object and buffer.
+   *
+   * The table only holds weak references, so an interned string is still collected once
+   * nothing else refers to it. Interning is opt-in: the reader does it for string literals
+   * when `--intern-strings` is given, and `intern-str` does it on request. */
+  obj::persistent_string_ptr intern_string(native_persistent_string const &s);
+  /* Same as above, but the given object becomes the interned one, if there isn't one yet. */
+  obj::persistent_string_ptr intern_string(obj::persistent_string_ptr s);
+
+  /* How many interned strings are still alive. Strings collected since the last lookup of
+   * their bucket may still be counted. */
+  size_t interned_string_count();
+
+  /* `clojure.core/intern-str`, which interns a string object. */
+  object_ptr intern_str(object_ptr o);
+}
@@ -10,7 +10,29 @@ namespace jank::runtime
     native_bool truthy(object_ptr o);
     native_bool truthy(obj::nil_ptr);
     native_bool truthy(obj::boolean_ptr const o);
-    native_bool truthy(native_bool const o);
+
+    /* Predicates like `<`, `nil?`, and `=` can be elided into native calls which yield a raw
+     * bool. These overloads are inline so that an `if` on such a predicate compiles down to
+     * a plain C++ branch, without boxing or a type dispatch. */
+    [[gnu::always_inline, gnu::flatten, gnu::hot]]
+    inline native_bool truthy(native_bool const o)
+    {
+      return o;
+    }
+
+    /* Unboxed numbers are never nil or false, so they're always truthy. Without these,
+     * they would implicitly convert to native_bool and zero would be falsey. */
+    [[gnu::always_inline, gnu::flatten, gnu::hot]]
+    inline native_bool truthy(native_integer const)
+    {
+      return true;
+    }
+
+    [[gnu::always_inline, gnu::flatten, gnu::hot]]
+    inline native_bool truthy(native_real const)
+    {
+      return true;
+    }
 
     template <typename T>
     requires runtime::behavior::objectable<T>
@@ -58,12 +58,14 @@ namespace jank::runtime
     native_box<static_object> clone() const;
 
     object base{ object_type::var };
+    mutable native_hash hash{};
     ns_ptr n{};
     obj::symbol_ptr name{};
     option<object_ptr> meta;
-    mutable native_hash hash{};
 
   private:
+    friend struct jank::detail::gc_layout<static_object>;
+
     folly::Synchronized<object_ptr> root;
 
   public:
@@ -141,3 +143,22 @@ namespace std
     }
   };
 }
+
+namespace jank::detail
+{
+  template <>
+  struct gc_layout<runtime::var>
+    : gc_fields<runtime::var,
+                &runtime::var::n,
+                &runtime::var::name,
+                &runtime::var::meta,
+                &runtime::var::root>
+  {
+  };
+
+  template <>
+  struct gc_layout<runtime::var_thread_binding>
+    : gc_fields<runtime::var_thread_binding, &runtime::var_thread_binding::value>
+  {
+  };
+}
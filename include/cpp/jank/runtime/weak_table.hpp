@@ -0,0 +1,40 @@
+#pragma once
+
+#include <unordered_map>
+#include <vector>
+
+#include <gc/gc.h>
+
+#include <jank/type.hpp>
+
+namespace jank::runtime
+{
+  struct object;
+
+  /* Objects held weakly, in buckets keyed by hash. Each object is held through a disappearing
+   * link, which the GC clears once the object is otherwise unreachable. The links live in
+   * uncollectable, pointer-free memory, and hold hidden pointers, so they're never seen as
+   * references. The table itself uses the normal heap, so the GC doesn't scan it at all.
+   *
+   * Buckets are pruned of cleared links whenever they're looked up. This isn't locked, so its
+   * owner needs to be. */
+  struct weak_table
+  {
+    using link = GC_hidden_pointer;
+
+    weak_table() = default;
+    weak_table(weak_table const &) = delete;
+    weak_table(weak_table &&) = delete;
+    ~weak_table();
+
+    /* The objects in this bucket which are still alive. The result is on the GC heap, so
+     * they stay alive for as long as it's held. */
+    native_vector<object *> find(native_hash hash);
+    /* Objects which aren't on the GC heap are never collected, so they're not held. */
+    void insert(native_hash hash, object *o);
+    /* Objects collected since the last lookup of their bucket may still be counted. */
+    size_t size() const;
+
+    std::unordered_map<native_hash, std::vector<link *>> buckets;
+  };
+}
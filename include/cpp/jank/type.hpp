@@ -4,12 +4,61 @@
 #include <set>
 #include <string_view>
 
+#include <gc/gc_allocator.h>
 #include <folly/FBVector.h>
 
+#include <jank/profile/alloc.hpp>
+
+/* gc_allocator allocates arrays of these atomically, so the GC doesn't scan them, but it
+ * doesn't know about all of our primitives. Strings are already covered, since char is. */
+template <>
+struct GC_type_traits<long long>
+{
+  GC_true_type GC_is_ptr_free;
+};
+
+template <>
+struct GC_type_traits<unsigned long long>
+{
+  GC_true_type GC_is_ptr_free;
+};
+
+template <>
+struct GC_type_traits<bool>
+{
+  GC_true_type GC_is_ptr_free;
+};
+
 namespace jank
 {
+  /* This is gc_allocator, but it also lets the allocation profiler count what it allocates. */
   template <typename T>
-  using native_allocator = gc_allocator<T>;
+  struct native_allocator : gc_allocator<T>
+  {
+    template <typename U>
+    struct rebind
+    {
+      using other = native_allocator<U>;
+    };
+
+    native_allocator() noexcept = default;
+    native_allocator(native_allocator const &) noexcept = default;
+
+    template <typename U>
+    native_allocator(native_allocator<U> const &) noexcept
+    {
+    }
+
+    T *allocate(size_t const n, void const * const hint = nullptr)
+    {
+      if(profile::alloc_sampling) [[unlikely]]
+      {
+        profile::count_allocation("native", n * sizeof(T));
+      }
+      return gc_allocator<T>::allocate(n, hint);
+    }
+  };
+
   using memory_policy = immer::memory_policy<immer::heap_policy<immer::gc_heap>,
                                              immer::no_refcount_policy,
                                              immer::default_lock_policy,
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace jank::util
+{
+  /* Bump allocation for the compiler's own temporaries, like expressions and frames, which
+   * are dead as soon as a form has been evaluated. Rather than leaving them for the GC to
+   * find and sweep, we release them all at once, when the arena is destroyed.
+   *
+   * Chunks are uncollectable GC memory, so the GC still scans them. They're full of pointers
+   * to runtime objects, like constants and macro results, which need to stay alive for as
+   * long as the compiler is using them. Those objects are never allocated here, though, so
+   * anything which escapes into the runtime is already on the GC heap.
+   *
+   * Types opt in with `arena_allocated`, after which `make_box` will use the current arena,
+   * if there is one. */
+  struct arena
+  {
+    static constexpr size_t chunk_size{ 64 * 1024 };
+
+    arena() = default;
+    arena(arena const &) = delete;
+    arena(arena &&) = delete;
+    ~arena();
+
+    void *allocate(size_t size, size_t alignment);
+
+    /* While a scope is alive, this thread allocates from its arena. Scopes nest, so a module
+     * being loaded while another form is evaluated gets its own arena. */
+    struct scope
+    {
+      scope() = delete;
+      scope(arena &a);
+      scope(scope const &) = delete;
+      scope(scope &&) = delete;
+      ~scope();
+
+      arena *previous{};
+    };
+
+    /* The arena of the innermost scope on this thread, if any. */
+    static arena *current();
+
+    /* These are never touched by the GC, so they use the normal heap. */
+    std::vector<void *> chunks;
+    char *cursor{};
+    char *end{};
+  };
+}
@@ -18,7 +18,15 @@ namespace jank::util::cli
     native_transient_string class_path;
     native_bool profiler_enabled{};
     native_transient_string profiler_file{ "jank.profile" };
+    native_integer alloc_sample_rate{};
+    native_transient_string alloc_profile_file{ "jank.alloc.folded" };
     native_bool gc_incremental{};
+    /* Zero leaves these to the GC's own defaults. */
+    size_t gc_initial_heap{};
+    size_t gc_max_heap{};
+    native_integer gc_markers{};
+    native_integer gc_free_space_divisor{};
+    native_bool intern_strings{};
 
     /* Compilation. */
     native_transient_string compilation_path{ "classes" };
@@ -27,6 +35,7 @@ namespace jank::util::cli
 #else
     native_integer optimization_level{ 0 };
 #endif
+    native_bool direct_linking{};
 
     /* Run command. */
     native_transient_string target_file;
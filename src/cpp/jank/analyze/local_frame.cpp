@@ -50,7 +50,15 @@ namespace jank::analyze
       make_box("has_boxed_usage"),
       make_box(has_boxed_usage),
       make_box("has_unboxed_usage"),
-      make_box(has_unboxed_usage));
+      make_box(has_unboxed_usage),
+      make_box("unboxed_type"),
+      (unboxed_type.is_none()
+         ? make_box("none")
+         : make_box(magic_enum::enum_name(unboxed_type.unwrap()))),
+      make_box("is_stack_allocated"),
+      make_box(is_stack_allocated),
+      make_box("shape"),
+      detail::to_runtime_data(shape));
   }
 
   local_frame::local_frame(frame_type const &type,
@@ -16,9 +16,187 @@
 
 namespace jank::analyze
 {
+  namespace detail
+  {
+    /* Folded results are lifted as constants, so they need to be plain data which codegen
+     * can render. Lazy seqs, fns, atoms, etc. are never folded. */
+    native_bool is_constant_data(runtime::object_ptr const o)
+    {
+      return runtime::visit_object(
+        [](auto const typed_o) -> native_bool {
+          using T = typename decltype(typed_o)::value_type;
+
+          if constexpr(std::same_as<T, runtime::obj::nil> || std::same_as<T, runtime::obj::boolean>
+                       || std::same_as<T, runtime::obj::integer>
+                       || std::same_as<T, runtime::obj::real>
+                       || std::same_as<T, runtime::obj::keyword>
+                       || std::same_as<T, runtime::obj::symbol>
+                       || std::same_as<T, runtime::obj::persistent_string>)
+          {
+            return true;
+          }
+          else if constexpr(std::same_as<T, runtime::obj::persistent_vector>
+                            || std::same_as<T, runtime::obj::persistent_list>
+                            || std::same_as<T, runtime::obj::persistent_set>)
+          {
+            if(typed_o->meta.is_some() && !is_constant_data(typed_o->meta.unwrap()))
+            {
+              return false;
+            }
+            for(auto const &e : typed_o->data)
+            {
+              if(!is_constant_data(e))
+              {
+                return false;
+              }
+            }
+            return true;
+          }
+          else if constexpr(std::same_as<T, runtime::obj::persistent_array_map>
+                            || std::same_as<T, runtime::obj::persistent_hash_map>)
+          {
+            if(typed_o->meta.is_some() && !is_constant_data(typed_o->meta.unwrap()))
+            {
+              return false;
+            }
+            for(auto const &kv : typed_o->data)
+            {
+              if(!is_constant_data(kv.first) || !is_constant_data(kv.second))
+              {
+                return false;
+              }
+            }
+            return true;
+          }
+          else
+          {
+            return false;
+          }
+        },
+        o);
+    }
+
+    /* Whether a call with this many args, to this local's value, can be a direct call into
+     * its struct. Like fn literals, we skip fns with a variadic arity, since packing the rest
+     * args is up to the dynamic call. */
+    native_bool is_direct_call_target(local_binding const &binding, size_t const arg_count)
+    {
+      if(binding.value_expr.is_none())
+      {
+        return false;
+      }
+
+      auto const * const fn(
+        boost::get<expr::function<expression>>(&binding.value_expr.unwrap()->data));
+      if(!fn)
+      {
+        return false;
+      }
+
+      native_bool found{};
+      for(auto const &arity : fn->arities)
+      {
+        if(arity.fn_ctx->is_variadic)
+        {
+          return false;
+        }
+        found |= arity.params.size() == arg_count;
+      }
+      return found;
+    }
+
+    /* The native number type an expression is known to produce, if any. Only literals,
+     * unboxed loop locals, and math on those are known. This is enough for recur to keep
+     * counters and accumulators unboxed; anything else boxes the loop local. */
+    option<runtime::object_type> unboxed_number_type(expression_ptr const &expr)
+    {
+      if(auto const * const literal = boost::get<expr::primitive_literal<expression>>(&expr->data))
+      {
+        if(literal->data->type == runtime::object_type::integer
+           || literal->data->type == runtime::object_type::real)
+        {
+          return literal->data->type;
+        }
+        return none;
+      }
+      else if(auto const * const local = boost::get<expr::local_reference>(&expr->data))
+      {
+        if(local->binding.needs_box)
+        {
+          return none;
+        }
+        return local->binding.unboxed_type;
+      }
+      else if(auto const * const call = boost::get<expr::call<expression>>(&expr->data))
+      {
+        auto const * const ref(boost::get<expr::var_deref<expression>>(&call->source_expr->data));
+        if(!ref || ref->qualified_name->ns != "clojure.core" || call->needs_box)
+        {
+          return none;
+        }
+
+        auto const &name(ref->qualified_name->name);
+        auto const arg_count(call->arg_exprs.size());
+        if(!((name == "+" || name == "-" || name == "*") && arg_count == 2)
+           && !((name == "inc" || name == "dec") && arg_count == 1))
+        {
+          return none;
+        }
+
+        /* Integers stay integers, but any real makes the result real. */
+        auto ret(runtime::object_type::integer);
+        for(auto const &arg : call->arg_exprs)
+        {
+          auto const arg_type(unboxed_number_type(arg));
+          if(arg_type.is_none())
+          {
+            return none;
+          }
+          else if(arg_type.unwrap() == runtime::object_type::real)
+          {
+            ret = runtime::object_type::real;
+          }
+        }
+        return ret;
+      }
+      return none;
+    }
+
+    /* Whether this arg to a clojure.core fn is only read during the call, without being held
+     * onto. apply spreads its last arg onto the stack, or copies it into a list, but its
+     * variadic arity conses onto it, so that one doesn't count. */
+    native_bool is_borrowed_arg(native_persistent_string const &name,
+                                size_t const index,
+                                size_t const arg_count)
+    {
+      if(name == "count" || name == "first" || name == "second" || name == "empty?")
+      {
+        return arg_count == 1;
+      }
+      else if(name == "nth")
+      {
+        return index == 0 && (arg_count == 2 || arg_count == 3);
+      }
+      else if(name == "apply")
+      {
+        return arg_count >= 2 && arg_count <= 5 && index == arg_count - 1;
+      }
+      return false;
+    }
+
+    void borrow_local(expression_ptr const &expr, local_frame_ptr const &frame)
+    {
+      if(auto const * const local = boost::get<expr::local_reference>(&expr->data))
+      {
+        ++frame->find_local_or_capture(local->name).unwrap().binding.borrowed_reference_count;
+      }
+    }
+  }
+
   processor::processor(runtime::context &rt_ctx)
     : rt_ctx{ rt_ctx }
-    , root_frame{ make_box<local_frame>(local_frame::frame_type::root, rt_ctx, none) }
+    /* The root frame outlives every form, so it can't come from the current arena. */
+    , root_frame{ new(GC) local_frame{ local_frame::frame_type::root, rt_ctx, none } }
   {
     using runtime::obj::symbol;
     auto const make_fn = [this](auto const fn) -> decltype(specials)::mapped_type {
@@ -36,7 +214,9 @@ namespace jank::analyze
       {     jank::make_box<symbol>("recur"),      make_fn(&processor::analyze_recur)},
       {        jank::make_box<symbol>("do"),         make_fn(&processor::analyze_do)},
       {      jank::make_box<symbol>("let*"),        make_fn(&processor::analyze_let)},
+      {     jank::make_box<symbol>("loop*"),       make_fn(&processor::analyze_loop)},
       {        jank::make_box<symbol>("if"),         make_fn(&processor::analyze_if)},
+      {     jank::make_box<symbol>("case*"),       make_fn(&processor::analyze_case)},
       {     jank::make_box<symbol>("quote"),      make_fn(&processor::analyze_quote)},
       {       jank::make_box<symbol>("var"),        make_fn(&processor::analyze_var)},
       {     jank::make_box<symbol>("throw"),      make_fn(&processor::analyze_throw)},
@@ -113,6 +293,33 @@ namespace jank::analyze
       return var.expect_err();
     }
 
+    /* Symbol meta doesn't otherwise make it onto the var, but `^:redef` needs to, since
+     * it opts the var out of direct linking. So does `:tag`, since a hinted return gives
+     * callers the shape of what they get back. */
+    if(sym->meta.is_some())
+    {
+      auto const redef(rt_ctx.intern_keyword("", "redef", true).expect_ok());
+      if(runtime::detail::truthy(runtime::get(sym->meta.unwrap(), redef)))
+      {
+        auto const v(var.expect_ok());
+        v->with_meta(runtime::assoc(
+          v->meta.unwrap_or(runtime::obj::persistent_array_map::empty()),
+          redef,
+          runtime::obj::boolean::true_const()));
+      }
+
+      auto const tag_kw(rt_ctx.intern_keyword("", "tag", true).expect_ok());
+      auto const tag(runtime::get(sym->meta.unwrap(), tag_kw));
+      if(tag != runtime::obj::nil::nil_const())
+      {
+        auto const v(var.expect_ok());
+        v->with_meta(runtime::assoc(
+          v->meta.unwrap_or(runtime::obj::persistent_array_map::empty()),
+          tag_kw,
+          tag));
+      }
+    }
+
     option<native_box<expression>> value_expr;
 
     if(has_value)
@@ -125,7 +332,9 @@ namespace jank::analyze
       }
       value_expr = some(value_result.expect_ok());
 
-      vars.insert_or_assign(var.expect_ok(), value_expr.unwrap());
+      vars.insert_or_assign(
+        var.expect_ok(),
+        boost::get<expr::function<expression>>(&value_expr.unwrap()->data) != nullptr);
     }
 
     return make_box<expression>(expr::def<expression>{
@@ -148,6 +357,10 @@ namespace jank::analyze
       auto &unwrapped_local(found_local.unwrap());
       local_frame::register_captures(unwrapped_local);
 
+      /* A capture counts as a reference to the originating local, which is never a direct
+       * call from within its own fn, so captured values always escape. */
+      ++unwrapped_local.binding.reference_count;
+
       /* Since we're referring to a local, we're boxed if it is boxed. */
       needs_box |= unwrapped_local.binding.needs_box;
 
@@ -278,7 +491,9 @@ namespace jank::analyze
         }
       }
 
-      frame->locals.emplace(sym, local_binding{ sym, none, current_frame });
+      local_binding binding{ sym, none, current_frame };
+      binding.shape = shape_from_meta(rt_ctx, sym->meta);
+      frame->locals.emplace(sym, std::move(binding));
       param_symbols.emplace_back(sym);
     }
 
@@ -439,6 +654,25 @@ namespace jank::analyze
       }
     }
 
+    /* Each arity lifts vars and constants into its own frame, but all arities end up in the
+     * same struct. So that each one gets a single fn-wide slot, every arity takes its names
+     * from the first, which collects the union of them. */
+    if(arities.size() > 1)
+    {
+      auto &shared(*arities.front().frame);
+      for(auto it(arities.begin() + 1); it != arities.end(); ++it)
+      {
+        for(auto &v : it->frame->lifted_vars)
+        {
+          v.second = shared.lifted_vars.emplace(v.first, v.second).first->second;
+        }
+        for(auto &c : it->frame->lifted_constants)
+        {
+          c.second = shared.lifted_constants.emplace(c.first, c.second).first->second;
+        }
+      }
+    }
+
     auto ret(make_box<expression>(expr::function<expression>{
       expression_base{{}, expr_type, current_frame},
       name,
@@ -495,24 +729,51 @@ namespace jank::analyze
     }
 
 
+    auto const &target_ctx(fn_ctx.unwrap());
     native_vector<expression_ptr> arg_exprs;
     arg_exprs.reserve(arg_count);
     for(auto const &form : list->data.rest())
     {
-      auto arg_expr(analyze(form, current_frame, expression_type::expression, fn_ctx, true));
+      /* Unboxed loop locals can be rebound without ever boxing the new value. */
+      option<runtime::object_type> unboxed_type;
+      if(target_ctx->loop_frame.is_some())
+      {
+        auto const &param(target_ctx->loop_params[arg_exprs.size()]);
+        unboxed_type = target_ctx->loop_frame.unwrap()->locals.find(param)->second.unboxed_type;
+      }
+
+      auto arg_expr(
+        analyze(form, current_frame, expression_type::expression, fn_ctx, unboxed_type.is_none()));
       if(arg_expr.is_err())
       {
         return arg_expr;
       }
+
+      /* The loop already boxed every local whose recur values it couldn't show to have the
+       * same native type, so this only fails if the two disagree. */
+      if(unboxed_type.is_some()
+         && detail::unboxed_number_type(arg_expr.expect_ok()) != unboxed_type)
+      {
+        return err(error{ fmt::format("internal error: recur value for unboxed loop local {} "
+                                      "doesn't have its native type",
+                                      target_ctx->loop_params[arg_exprs.size()]->to_string()) });
+      }
       arg_exprs.emplace_back(arg_expr.expect_ok());
     }
 
-    fn_ctx.unwrap()->is_tail_recursive = true;
+    target_ctx->is_tail_recursive = true;
+
+    option<expr::function_context_ptr> loop_ctx;
+    if(target_ctx->loop_frame.is_some())
+    {
+      loop_ctx = target_ctx;
+    }
 
     return make_box<expression>(expr::recur<expression>{
       expression_base{{}, expr_type, current_frame},
       jank::make_box<runtime::obj::persistent_list>(list->data.rest()),
-      arg_exprs
+      arg_exprs,
+      loop_ctx
     });
   }
 
@@ -609,9 +870,21 @@ namespace jank::analyze
         return res.expect_err_move();
       }
       auto it(ret.pairs.emplace_back(sym, res.expect_ok_move()));
-      ret.frame->locals.emplace(
-        sym,
-        local_binding{ sym, some(it.second), current_frame, it.second->get_base()->needs_box });
+      local_binding binding{ sym,
+                             some(it.second),
+                             current_frame,
+                             it.second->get_base()->needs_box };
+      binding.shape = find_shape(rt_ctx, it.second);
+      if(binding.shape.is_none())
+      {
+        binding.shape = shape_from_meta(rt_ctx, sym->meta);
+      }
+      /* A name bound twice keeps its first binding, which would then have the wrong shape. */
+      auto const emplaced(ret.frame->locals.emplace(sym, std::move(binding)));
+      if(!emplaced.second)
+      {
+        emplaced.first->second.shape = none;
+      }
     }
 
     size_t const form_count{ o->count() - 2 };
@@ -635,6 +908,408 @@ namespace jank::analyze
       ret.body.body.emplace_back(res.expect_ok_move());
     }
 
+    /* Now that the body is analyzed, we've seen every reference to these locals. Fn values
+     * which are only ever called directly, from within this fn, can't escape, so codegen
+     * can keep them on the stack. A name bound twice in the same let keeps its first
+     * binding, so we only consider the value that binding came from. */
+    for(auto const &pair : ret.pairs)
+    {
+      auto &binding(ret.frame->locals.find(pair.first)->second);
+      binding.is_stack_allocated = binding.value_expr.unwrap().data == pair.second.data
+        && binding.direct_call_count > 0
+        && binding.direct_call_count == binding.reference_count;
+    }
+
+    return make_box<expression>(std::move(ret));
+  }
+
+  void processor::find_tail_recurs(runtime::object_ptr const form,
+                                   native_set<runtime::obj::symbol_ptr> const &shadowed,
+                                   native_vector<tail_recur> &found)
+  {
+    if(form->type != runtime::object_type::persistent_list)
+    {
+      return;
+    }
+
+    auto const list(runtime::expect_object<runtime::obj::persistent_list>(form));
+    auto const count(list->count());
+    if(count == 0 || list->data.first().unwrap()->type != runtime::object_type::symbol)
+    {
+      return;
+    }
+
+    auto const sym(runtime::expect_object<runtime::obj::symbol>(list->data.first().unwrap()));
+    if(specials.find(sym) == specials.end())
+    {
+      auto const expanded(rt_ctx.macroexpand(list));
+      if(expanded != form)
+      {
+        find_tail_recurs(expanded, shadowed, found);
+      }
+      return;
+    }
+
+    /* Only these have forms in tail position. A nested loop* is the target of its own recurs,
+     * and anything else can't contain a valid recur at all. */
+    if(sym->name == "recur")
+    {
+      found.emplace_back(tail_recur{ list, shadowed });
+    }
+    else if(sym->name == "do" && count > 1)
+    {
+      find_tail_recurs(runtime::nth(list, make_box(count - 1)), shadowed, found);
+    }
+    else if(sym->name == "if" && count > 2)
+    {
+      find_tail_recurs(runtime::nth(list, make_box(2)), shadowed, found);
+      if(count > 3)
+      {
+        find_tail_recurs(runtime::nth(list, make_box(3)), shadowed, found);
+      }
+    }
+    else if(sym->name == "let*" && count > 2)
+    {
+      auto inner(shadowed);
+      auto const bindings(list->data.rest().first().unwrap());
+      if(bindings->type == runtime::object_type::persistent_vector)
+      {
+        auto const &data(runtime::expect_object<runtime::obj::persistent_vector>(bindings)->data);
+        for(size_t i{}; i < data.size(); i += 2)
+        {
+          if(data[i]->type == runtime::object_type::symbol)
+          {
+            inner.emplace(runtime::expect_object<runtime::obj::symbol>(data[i]));
+          }
+        }
+      }
+      find_tail_recurs(runtime::nth(list, make_box(count - 1)), inner, found);
+    }
+    else if(sym->name == "case*" && count > 2)
+    {
+      /* The default, then every other form after it, is a branch. */
+      size_t i{};
+      for(auto const &item : list->data.rest().rest())
+      {
+        if(i++ % 2 == 0)
+        {
+          find_tail_recurs(item, shadowed, found);
+        }
+      }
+    }
+  }
+
+  option<runtime::object_type>
+  processor::recur_arg_type(runtime::object_ptr const form,
+                            native_set<runtime::obj::symbol_ptr> const &shadowed,
+                            native_vector<runtime::obj::symbol_ptr> const &params,
+                            native_vector<option<runtime::object_type>> const &param_types,
+                            local_frame_ptr const &outer_frame)
+  {
+    /* This needs to be at least as strict as detail::unboxed_number_type, since recur checks
+     * the analyzed args against what we find here. */
+    auto const local_type([&](runtime::obj::symbol_ptr const sym,
+                              native_bool &is_local) -> option<runtime::object_type> {
+      is_local = true;
+      if(shadowed.contains(sym))
+      {
+        return none;
+      }
+      for(size_t i{}; i < params.size(); ++i)
+      {
+        if(params[i]->equal(*sym))
+        {
+          return param_types[i];
+        }
+      }
+
+      auto const found(outer_frame->find_originating_local(sym));
+      if(found.is_none())
+      {
+        is_local = false;
+        return none;
+      }
+      auto const &binding(found.unwrap().binding);
+      if(!found.unwrap().crossed_fns.empty() || binding.needs_box)
+      {
+        return none;
+      }
+      return binding.unboxed_type;
+    });
+
+    native_bool is_local{};
+    if(form->type == runtime::object_type::integer || form->type == runtime::object_type::real)
+    {
+      return form->type;
+    }
+    else if(form->type == runtime::object_type::symbol)
+    {
+      auto const sym(runtime::expect_object<runtime::obj::symbol>(form));
+      if(!sym->ns.empty())
+      {
+        return none;
+      }
+      return local_type(sym, is_local);
+    }
+    else if(form->type != runtime::object_type::persistent_list)
+    {
+      return none;
+    }
+
+    auto const list(runtime::expect_object<runtime::obj::persistent_list>(form));
+    auto const arg_count(list->count() - 1);
+    if(list->data.empty() || list->data.first().unwrap()->type != runtime::object_type::symbol)
+    {
+      return none;
+    }
+
+    auto const sym(runtime::expect_object<runtime::obj::symbol>(list->data.first().unwrap()));
+    if(specials.find(sym) != specials.end())
+    {
+      return none;
+    }
+    if(sym->ns.empty())
+    {
+      local_type(sym, is_local);
+      if(is_local)
+      {
+        return none;
+      }
+    }
+
+    auto const qualified_sym(rt_ctx.qualify_symbol(sym));
+    auto const &name(qualified_sym->name);
+    if(qualified_sym->ns != "clojure.core"
+       || (!((name == "+" || name == "-" || name == "*") && arg_count == 2)
+           && !((name == "inc" || name == "dec") && arg_count == 1)))
+    {
+      return none;
+    }
+
+    /* The call is only unboxed if its var says so. */
+    auto const var(rt_ctx.find_var(qualified_sym));
+    if(var.is_none() || var.unwrap()->meta.is_none())
+    {
+      return none;
+    }
+    auto const arity_meta(
+      runtime::get_in(var.unwrap()->meta.unwrap(),
+                      make_box<runtime::obj::persistent_vector>(
+                        std::in_place,
+                        rt_ctx.intern_keyword("", "arities", true).expect_ok(),
+                        make_box(arg_count))));
+    if(!runtime::detail::truthy(
+         get(arity_meta, rt_ctx.intern_keyword("", "unboxed-output?", true).expect_ok())))
+    {
+      return none;
+    }
+
+    auto ret(runtime::object_type::integer);
+    for(auto const &arg : list->data.rest())
+    {
+      auto const arg_type(recur_arg_type(arg, shadowed, params, param_types, outer_frame));
+      if(arg_type.is_none())
+      {
+        return none;
+      }
+      else if(arg_type.unwrap() == runtime::object_type::real)
+      {
+        ret = runtime::object_type::real;
+      }
+    }
+    return ret;
+  }
+
+  processor::expression_result
+  processor::analyze_loop(runtime::obj::persistent_list_ptr const &o,
+                          local_frame_ptr &current_frame,
+                          expression_type const expr_type,
+                          option<expr::function_context_ptr> const &fn_ctx,
+                          native_bool const)
+  {
+    if(o->count() < 2)
+    {
+      return err(error{ "invalid loop: expects bindings" });
+    }
+
+    auto const bindings_obj(o->data.rest().first().unwrap());
+    if(bindings_obj->type != runtime::object_type::persistent_vector)
+    {
+      return err(error{ "invalid loop* bindings: must be a vector" });
+    }
+
+    auto const bindings(runtime::expect_object<runtime::obj::persistent_vector>(bindings_obj));
+
+    auto const binding_parts(bindings->data.size());
+    if(binding_parts % 2 == 1)
+    {
+      return err(error{ "invalid loop* bindings: must be an even number" });
+    }
+
+    /* Recur needs a single native type for an unboxed local, for the whole loop. We know it
+     * for number literals and for locals hinted with ^{:tag long} or ^{:tag double}. All other
+     * locals are boxed. */
+    native_vector<runtime::obj::symbol_ptr> params;
+    native_vector<option<runtime::object_type>> param_types;
+    params.reserve(binding_parts / 2);
+    param_types.reserve(binding_parts / 2);
+    auto const tag_kw(rt_ctx.intern_keyword("", "tag", true).expect_ok());
+    for(size_t i{}; i < binding_parts; i += 2)
+    {
+      auto const &sym_obj(bindings->data[i]);
+      auto const &val(bindings->data[i + 1]);
+
+      if(sym_obj->type != runtime::object_type::symbol)
+      {
+        return err(error{ fmt::format("invalid loop* binding: left hand must be a symbol, not {}",
+                                      runtime::detail::to_string(sym_obj)) });
+      }
+      auto const &sym(runtime::expect_object<runtime::obj::symbol>(sym_obj));
+      if(!sym->ns.empty())
+      {
+        return err(error{
+          fmt::format("invalid loop* binding: left hand must be an unqualified symbol, not {}",
+                      sym->to_string()) });
+      }
+      /* Recur rebinds loop locals by name, so a shadowed one could never be rebound. */
+      for(auto const &param : params)
+      {
+        if(param->equal(*sym))
+        {
+          return err(error{
+            fmt::format("invalid loop* binding: duplicate name {}", sym->to_string()) });
+        }
+      }
+
+      option<runtime::object_type> unboxed_type;
+      if(val->type == runtime::object_type::integer || val->type == runtime::object_type::real)
+      {
+        unboxed_type = val->type;
+      }
+      if(sym->meta.is_some())
+      {
+        auto const tag(runtime::get(sym->meta.unwrap(), tag_kw));
+        native_persistent_string tag_name;
+        if(tag->type == runtime::object_type::symbol)
+        {
+          tag_name = runtime::expect_object<runtime::obj::symbol>(tag)->name;
+        }
+        else if(tag->type == runtime::object_type::keyword)
+        {
+          tag_name = runtime::expect_object<runtime::obj::keyword>(tag)->sym.name;
+        }
+
+        if(tag_name == "long")
+        {
+          unboxed_type = runtime::object_type::integer;
+        }
+        else if(tag_name == "double")
+        {
+          unboxed_type = runtime::object_type::real;
+        }
+      }
+
+      params.emplace_back(sym);
+      param_types.emplace_back(unboxed_type);
+    }
+
+    /* Like Clojure, a loop local whose recur values don't match its native type gets boxed
+     * instead. Boxing one local can change the type of a value given to another, so we go
+     * until nothing changes. Each round boxes at least one more local, so this ends. */
+    native_set<size_t> boxed_params;
+    if(o->count() > 2)
+    {
+      native_vector<tail_recur> recurs;
+      find_tail_recurs(runtime::nth(o, make_box(o->count() - 1)), {}, recurs);
+
+      native_bool changed{ true };
+      while(changed)
+      {
+        changed = false;
+        for(auto const &recur : recurs)
+        {
+          /* The wrong number of args is an error which analysis will report. */
+          if(recur.form->count() - 1 != params.size())
+          {
+            continue;
+          }
+
+          size_t i{};
+          for(auto const &arg : recur.form->data.rest())
+          {
+            if(param_types[i].is_some()
+               && recur_arg_type(arg, recur.shadowed, params, param_types, current_frame)
+                 != param_types[i])
+            {
+              param_types[i] = none;
+              boxed_params.emplace(i);
+              changed = true;
+            }
+            ++i;
+          }
+        }
+      }
+    }
+
+    /* Loop results are always boxed. Unboxed lets use an IIFE, which doesn't work with the
+     * generated while/continue, and the same is true for us. */
+    expr::let<expression> ret{
+      expr_type,
+      true,
+      make_box<local_frame>(local_frame::frame_type::let, current_frame->rt_ctx, current_frame)
+    };
+    ret.is_loop = true;
+
+    /* The loop is its own recur target, so its body gets a fresh context. */
+    auto loop_ctx(make_box<expr::function_context>());
+    loop_ctx->param_count = binding_parts / 2;
+    loop_ctx->loop_frame = ret.frame;
+    loop_ctx->loop_params = params;
+    loop_ctx->loop_boxed_params = boxed_params;
+
+    for(size_t i{}; i < params.size(); ++i)
+    {
+      auto res(
+        analyze(bindings->data[i * 2 + 1], ret.frame, expression_type::expression, fn_ctx, false));
+      if(res.is_err())
+      {
+        return res.expect_err_move();
+      }
+
+      auto const &sym(params[i]);
+      auto it(ret.pairs.emplace_back(sym, res.expect_ok_move()));
+      local_binding binding{ sym, some(it.second), current_frame, param_types[i].is_none() };
+      binding.unboxed_type = param_types[i];
+      binding.shape = shape_from_meta(rt_ctx, sym->meta);
+      ret.frame->locals.emplace(sym, std::move(binding));
+    }
+
+    /* A loop within a try is its own recur target, so recur is fine again. */
+    rt_ctx
+      .push_thread_bindings(runtime::obj::persistent_hash_map::create_unique(
+        std::make_pair(rt_ctx.no_recur_var, runtime::obj::boolean::false_const())))
+      .expect_ok();
+    util::scope_exit const finally{ [&]() { rt_ctx.pop_thread_bindings().expect_ok(); } };
+
+    option<expr::function_context_ptr> const body_ctx{ loop_ctx };
+    size_t const form_count{ o->count() - 2 };
+    size_t i{};
+    for(auto const &item : o->data.rest().rest())
+    {
+      /* The last form is always in return position, since that's where recur lives. When
+       * the loop itself isn't in return position, codegen wraps it in an IIFE. */
+      auto const is_last(++i == form_count);
+      auto const form_type(is_last ? expression_type::return_statement
+                                   : expression_type::statement);
+      auto res(analyze(item, ret.frame, form_type, body_ctx, is_last));
+      if(res.is_err())
+      {
+        return res.expect_err_move();
+      }
+
+      ret.body.body.emplace_back(res.expect_ok_move());
+    }
+
     return make_box<expression>(std::move(ret));
   }
 
@@ -667,6 +1342,23 @@ namespace jank::analyze
       return condition_expr.expect_err_move();
     }
 
+    /* Only the truthiness of the condition is used, so neither a local nor `(seq local)`
+     * holds onto the local here. */
+    auto const &condition_data(condition_expr.expect_ok());
+    if(auto const * const call = boost::get<expr::call<expression>>(&condition_data->data))
+    {
+      auto const * const ref(boost::get<expr::var_deref<expression>>(&call->source_expr->data));
+      if(ref && ref->qualified_name->ns == "clojure.core" && ref->qualified_name->name == "seq"
+         && call->arg_exprs.size() == 1)
+      {
+        detail::borrow_local(call->arg_exprs[0], current_frame);
+      }
+    }
+    else
+    {
+      detail::borrow_local(condition_data, current_frame);
+    }
+
     auto const then(o->data.rest().rest().first().unwrap());
     auto then_expr(analyze(then, current_frame, expr_type, fn_ctx, needs_box));
     if(then_expr.is_err())
@@ -695,6 +1387,92 @@ namespace jank::analyze
     });
   }
 
+  processor::expression_result
+  processor::analyze_case(runtime::obj::persistent_list_ptr const &o,
+                          local_frame_ptr &current_frame,
+                          expression_type const expr_type,
+                          option<expr::function_context_ptr> const &fn_ctx,
+                          native_bool needs_box)
+  {
+    /* Same as with if, each branch could have a different unboxed type. */
+    needs_box = true;
+
+    auto const form_count(o->count());
+    if(form_count < 3)
+    {
+      return err(error{ "invalid case*: expects a value and a default" });
+    }
+    else if((form_count - 3) % 2 != 0)
+    {
+      return err(error{ "invalid case*: expects an even number of clause forms" });
+    }
+
+    auto it(o->data.rest());
+    auto value_expr(
+      analyze(it.first().unwrap(), current_frame, expression_type::expression, fn_ctx, true));
+    if(value_expr.is_err())
+    {
+      return value_expr.expect_err_move();
+    }
+
+    it = it.rest();
+    auto default_expr(analyze(it.first().unwrap(), current_frame, expr_type, fn_ctx, needs_box));
+    if(default_expr.is_err())
+    {
+      return default_expr.expect_err_move();
+    }
+
+    expr::case_<expression> ret{
+      expression_base{{}, expr_type, current_frame, needs_box},
+      value_expr.expect_ok(),
+      default_expr.expect_ok(),
+      {},
+      {},
+      true
+    };
+
+    for(it = it.rest(); !it.empty(); it = it.rest().rest())
+    {
+      auto const test_list(it.first().unwrap());
+      if(test_list->type != runtime::object_type::persistent_list)
+      {
+        return err(error{ "invalid case*: expects each clause's tests to be in a list" });
+      }
+
+      auto const tests(runtime::expect_object<runtime::obj::persistent_list>(test_list));
+      if(tests->data.empty())
+      {
+        return err(error{ "invalid case*: expects each clause to have at least one test" });
+      }
+
+      for(auto const &test : tests->data)
+      {
+        for(auto const &existing : ret.tests)
+        {
+          if(runtime::detail::equal(existing.first, test))
+          {
+            return err(error{ fmt::format("invalid case*: duplicate test constant {}",
+                                          runtime::detail::to_string(test)) });
+          }
+        }
+
+        current_frame->lift_constant(test);
+        ret.tests.emplace_back(test, ret.branches.size());
+        ret.all_integers &= test->type == runtime::object_type::integer;
+      }
+
+      auto branch_expr(
+        analyze(it.rest().first().unwrap(), current_frame, expr_type, fn_ctx, needs_box));
+      if(branch_expr.is_err())
+      {
+        return branch_expr.expect_err_move();
+      }
+      ret.branches.emplace_back(branch_expr.expect_ok());
+    }
+
+    return make_box<expression>(std::move(ret));
+  }
+
   processor::expression_result
   processor::analyze_quote(runtime::obj::persistent_list_ptr const &o,
                            local_frame_ptr &current_frame,
@@ -1202,6 +1980,17 @@ namespace jank::analyze
       }
 
       source = sym_result.expect_ok();
+
+      /* Calling a local doesn't let it escape, so we count these against its references. */
+      if(boost::get<expr::local_reference>(&source->data))
+      {
+        auto &binding(current_frame->find_local_or_capture(sym).unwrap().binding);
+        if(detail::is_direct_call_target(binding, arg_count))
+        {
+          ++binding.direct_call_count;
+        }
+      }
+
       auto var_deref(boost::get<expr::var_deref<expression>>(&source->data));
 
       /* If this expression doesn't need to be boxed, based on where it's called, we can dig
@@ -1230,13 +2019,9 @@ namespace jank::analyze
            * don't have an AST node for it. This means the var came in through
            * a pre-compiled module. In that case, we can only rely on meta to
            * tell us what we need. */
-          if(fn_res != vars.end())
+          if(fn_res != vars.end() && !fn_res->second)
           {
-            auto const fn(boost::get<expr::function<expression>>(&fn_res->second->data));
-            if(!fn)
-            {
-              return err(error{ "unsupported arity meta on non-function var" });
-            }
+            return err(error{ "unsupported arity meta on non-function var" });
           }
 
           needs_arg_box = !supports_unboxed_input;
@@ -1246,6 +2031,13 @@ namespace jank::analyze
     }
     else
     {
+      /* Keyword literal calls become a direct map lookup in codegen, so we can catch a bad
+       * arity here, rather than at runtime. */
+      if(first->type == runtime::object_type::keyword && arg_count != 1 && arg_count != 2)
+      {
+        return err(error{ fmt::format("invalid call to keyword with {} args", arg_count) });
+      }
+
       auto callable_expr(
         analyze(first, current_frame, expression_type::expression, fn_ctx, needs_box));
       if(callable_expr.is_err())
@@ -1267,6 +2059,30 @@ namespace jank::analyze
       arg_exprs.emplace_back(arg_expr.expect_ok());
     }
 
+    if(auto const * const var_deref = boost::get<expr::var_deref<expression>>(&source->data))
+    {
+      if(var_deref->qualified_name->ns == "clojure.core")
+      {
+        for(size_t i{}; i < arg_exprs.size(); ++i)
+        {
+          if(detail::is_borrowed_arg(var_deref->qualified_name->name, i, arg_exprs.size()))
+          {
+            detail::borrow_local(arg_exprs[i], current_frame);
+          }
+        }
+      }
+
+      auto const folded(fold_pure_call(var_deref->var, arg_exprs));
+      if(folded.is_some())
+      {
+        return analyze_primitive_literal(folded.unwrap(),
+                                         current_frame,
+                                         expr_type,
+                                         fn_ctx,
+                                         needs_box);
+      }
+    }
+
     return make_box<expression>(expr::call<expression>{
       expression_base{{}, expr_type, current_frame, needs_ret_box},
       source,
@@ -1344,6 +2160,62 @@ namespace jank::analyze
       o);
   }
 
+  option<runtime::object_ptr>
+  processor::fold_pure_call(runtime::var_ptr const var,
+                            native_vector<expression_ptr> const &arg_exprs)
+  {
+    if(var->meta.is_none())
+    {
+      return none;
+    }
+
+    auto const pure(
+      runtime::get(var->meta.unwrap(), rt_ctx.intern_keyword("", "pure", true).expect_ok()));
+    if(!runtime::detail::truthy(pure))
+    {
+      return none;
+    }
+    auto const numbers_only(
+      pure == runtime::object_ptr{ rt_ctx.intern_keyword("", "numbers", true).expect_ok() });
+
+    runtime::object_ptr args(make_box<runtime::obj::persistent_vector>());
+    for(auto const &arg_expr : arg_exprs)
+    {
+      auto const literal(boost::get<expr::primitive_literal<expression>>(&arg_expr->data));
+      if(!literal || !detail::is_constant_data(literal->data))
+      {
+        return none;
+      }
+      /* Math on anything else would only throw, so we don't bother calling it. */
+      else if(numbers_only && literal->data->type != runtime::object_type::integer
+              && literal->data->type != runtime::object_type::real)
+      {
+        return none;
+      }
+      args = runtime::conj(args, literal->data);
+    }
+
+    /* If the call fails, we leave it for run-time, so the error shows up where it would
+     * have without folding. Anything other than the runtime's own errors is a real problem,
+     * so that's left to propagate. */
+    try
+    {
+      auto const ret(runtime::apply_to(var->get_root(), args));
+      if(ret && detail::is_constant_data(ret))
+      {
+        return ret;
+      }
+    }
+    catch(std::runtime_error const &)
+    {
+    }
+    catch(runtime::object_ptr const &)
+    {
+    }
+
+    return none;
+  }
+
   native_bool processor::is_special(runtime::object_ptr const form)
   {
     if(form->type != runtime::object_type::symbol)
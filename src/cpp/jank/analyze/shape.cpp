@@ -0,0 +1,141 @@
+#include <magic_enum.hpp>
+
+#include <jank/runtime/obj/persistent_array_map.hpp>
+#include <jank/runtime/obj/persistent_vector.hpp>
+#include <jank/analyze/shape.hpp>
+#include <jank/analyze/expression.hpp>
+
+namespace jank::analyze
+{
+  runtime::object_ptr value_shape::to_runtime_data() const
+  {
+    runtime::object_ptr key_vec(make_box<runtime::obj::persistent_vector>());
+    if(keys.is_some())
+    {
+      for(auto const &k : keys.unwrap())
+      {
+        key_vec = runtime::conj(key_vec, k);
+      }
+    }
+
+    return runtime::obj::persistent_array_map::create_unique(
+      make_box("__type"),
+      make_box("value_shape"),
+      make_box("type"),
+      make_box(magic_enum::enum_name(type)),
+      make_box("exact"),
+      make_box(exact),
+      make_box("size"),
+      (size.is_none() ? make_box("none") : make_box(static_cast<native_integer>(size.unwrap()))),
+      make_box("keys"),
+      key_vec);
+  }
+
+  option<value_shape>
+  shape_from_meta(runtime::context &rt_ctx, option<runtime::object_ptr> const &meta)
+  {
+    if(meta.is_none())
+    {
+      return none;
+    }
+
+    auto const tag(
+      runtime::get(meta.unwrap(), rt_ctx.intern_keyword("", "tag", true).expect_ok()));
+    native_persistent_string tag_name;
+    if(tag->type == runtime::object_type::symbol)
+    {
+      tag_name = runtime::expect_object<runtime::obj::symbol>(tag)->name;
+    }
+    else if(tag->type == runtime::object_type::keyword)
+    {
+      tag_name = runtime::expect_object<runtime::obj::keyword>(tag)->sym.name;
+    }
+
+    if(tag_name == "vector")
+    {
+      return value_shape{ value_shape::kind::vector };
+    }
+    else if(tag_name == "map")
+    {
+      return value_shape{ value_shape::kind::map };
+    }
+    return none;
+  }
+
+  option<value_shape> find_shape(runtime::context &rt_ctx, native_box<expression> const &expr)
+  {
+    return boost::apply_visitor(
+      [&](auto const &typed_expr) -> option<value_shape> {
+        using T = std::decay_t<decltype(typed_expr)>;
+
+        if constexpr(std::same_as<T, expr::vector<expression>>)
+        {
+          return value_shape{ value_shape::kind::vector, true, typed_expr.data_exprs.size() };
+        }
+        else if constexpr(std::same_as<T, expr::map<expression>>)
+        {
+          value_shape ret{ value_shape::kind::map, true };
+          if(typed_expr.data_exprs.size() > runtime::obj::persistent_array_map::max_size)
+          {
+            return ret;
+          }
+
+          native_vector<runtime::object_ptr> keys;
+          keys.reserve(typed_expr.data_exprs.size());
+          for(auto const &pair : typed_expr.data_exprs)
+          {
+            auto const * const literal(
+              boost::get<expr::primitive_literal<expression>>(&pair.first->data));
+            if(!literal)
+            {
+              return ret;
+            }
+            keys.emplace_back(literal->data);
+          }
+          ret.keys = std::move(keys);
+          return ret;
+        }
+        else if constexpr(std::same_as<T, expr::primitive_literal<expression>>)
+        {
+          if(typed_expr.data->type == runtime::object_type::persistent_vector)
+          {
+            return value_shape{
+              value_shape::kind::vector,
+              true,
+              runtime::expect_object<runtime::obj::persistent_vector>(typed_expr.data)->data.size()
+            };
+          }
+          else if(typed_expr.data->type == runtime::object_type::persistent_array_map)
+          {
+            native_vector<runtime::object_ptr> keys;
+            for(auto const &pair :
+                runtime::expect_object<runtime::obj::persistent_array_map>(typed_expr.data)->data)
+            {
+              keys.emplace_back(pair.first);
+            }
+            return value_shape{ value_shape::kind::map, true, none, std::move(keys) };
+          }
+          return none;
+        }
+        else if constexpr(std::same_as<T, expr::local_reference>)
+        {
+          return typed_expr.binding.shape;
+        }
+        else if constexpr(std::same_as<T, expr::call<expression>>)
+        {
+          auto const * const ref(
+            boost::get<expr::var_deref<expression>>(&typed_expr.source_expr->data));
+          if(!ref)
+          {
+            return none;
+          }
+          return shape_from_meta(rt_ctx, ref->var->meta);
+        }
+        else
+        {
+          return none;
+        }
+      },
+      expr->data);
+  }
+}
@@ -16,6 +16,14 @@ namespace jank::analyze::step
             boost::apply_visitor(f, typed_expr.else_.unwrap()->data);
           }
         }
+        else if constexpr(std::same_as<T, expr::case_<expression>>)
+        {
+          boost::apply_visitor(f, typed_expr.default_expr->data);
+          for(auto const &branch : typed_expr.branches)
+          {
+            boost::apply_visitor(f, branch->data);
+          }
+        }
         else if constexpr(std::same_as<T, expr::do_<expression>>)
         {
           if(!typed_expr.body.empty())
@@ -1,4 +1,5 @@
 #include <iostream>
+#include <map>
 
 #include <jank/runtime/context.hpp>
 #include <jank/runtime/obj/number.hpp>
@@ -55,6 +56,41 @@ namespace jank::codegen
      * the actual param names as mutable locals outside of the while loop. */
     constexpr native_persistent_string_view const recur_suffix{ "__recur" };
 
+    /* Rest args which escape are copied off of the caller's stack on entry, so the param is
+     * named with this suffix and the actual param name is given to the copy. */
+    constexpr native_persistent_string_view const rest_suffix{ "__rest" };
+
+    /* Constants of local fns are interned by a static accessor with this suffix. */
+    constexpr native_persistent_string_view const static_constant_suffix{ "__static" };
+
+    /* Nil, booleans, keywords, and vars are unique already. Everything else is
+     * interned, so all fns using the same constant share it. */
+    native_bool is_interned_constant(runtime::object_ptr const o)
+    {
+      return o->type != runtime::object_type::nil && o->type != runtime::object_type::boolean
+        && o->type != runtime::object_type::keyword && o->type != runtime::object_type::var;
+    }
+
+    /* The rest param of a variadic arity, if it's referenced as anything other than a
+     * borrowed arg. */
+    runtime::obj::symbol_ptr
+    escaping_rest_param(analyze::expr::function_arity<analyze::expression> const &arity)
+    {
+      if(!arity.fn_ctx->is_variadic || arity.params.empty())
+      {
+        return nullptr;
+      }
+
+      auto const param(arity.params.back());
+      auto const found(arity.frame->locals.find(param));
+      if(found != arity.frame->locals.end()
+         && found->second.borrowed_reference_count == found->second.reference_count)
+      {
+        return nullptr;
+      }
+      return param;
+    }
+
     /* TODO: Consider making this a on the typed object: the C++ name. */
     native_persistent_string_view
     gen_constant_type(runtime::object_ptr const o, native_bool const boxed)
@@ -322,10 +358,107 @@ namespace jank::codegen
         o);
     }
 
+    /* Vars can declare a C++ fn to which their calls are compiled, similar to Clojure's
+     * `:inline` meta. Since we're generating C++, `:inline` is just the name of that fn,
+     * which may be overloaded for boxed and unboxed values. `:inline-arities` is the set
+     * of arities for which it applies; there's no default, since variadic arities can't
+     * be inlined. Boxing is described by the same `:arities` meta the analyzer uses. */
+    struct inline_call
+    {
+      native_persistent_string fn_name;
+      native_bool supports_unboxed_input{};
+      native_bool unboxed_output{};
+    };
+
+    option<inline_call> find_inline_call(runtime::context &rt_ctx,
+                                         runtime::var_ptr const var,
+                                         size_t const arg_count)
+    {
+      if(var->meta.is_none())
+      {
+        return none;
+      }
+
+      auto const meta(var->meta.unwrap());
+      auto const fn_name(
+        runtime::get(meta, rt_ctx.intern_keyword("", "inline", true).expect_ok()));
+      if(fn_name->type != runtime::object_type::persistent_string)
+      {
+        return none;
+      }
+
+      auto const arity(make_box(arg_count));
+      auto const inline_arities(
+        runtime::get(meta, rt_ctx.intern_keyword("", "inline-arities", true).expect_ok()));
+      if(!runtime::contains(inline_arities, arity))
+      {
+        return none;
+      }
+
+      auto const arity_meta(runtime::get_in(
+        meta,
+        make_box<runtime::obj::persistent_vector>(
+          std::in_place,
+          rt_ctx.intern_keyword("", "arities", true).expect_ok(),
+          arity)));
+      return inline_call{
+        runtime::expect_object<runtime::obj::persistent_string>(fn_name)->data,
+        runtime::detail::truthy(runtime::get(
+          arity_meta,
+          rt_ctx.intern_keyword("", "supports-unboxed-input?", true).expect_ok())),
+        runtime::detail::truthy(
+          runtime::get(arity_meta, rt_ctx.intern_keyword("", "unboxed-output?", true).expect_ok()))
+      };
+    }
+
+    runtime::context::direct_link_target const *
+    find_direct_link(runtime::context &rt_ctx, runtime::var_ptr const var)
+    {
+      if(!rt_ctx.direct_linking)
+      {
+        return nullptr;
+      }
+
+      auto const found(rt_ctx.direct_link_targets.find(var));
+      if(found == rt_ctx.direct_link_targets.end())
+      {
+        return nullptr;
+      }
+      return &found->second;
+    }
+
+    runtime::context::direct_link_target const *
+    find_direct_link(runtime::context &rt_ctx, runtime::obj::symbol_ptr const &var_name)
+    {
+      auto const var(rt_ctx.find_var(var_name));
+      if(var.is_none())
+      {
+        return nullptr;
+      }
+      return find_direct_link(rt_ctx, var.unwrap());
+    }
+
+    native_persistent_string direct_link_name(native_persistent_string const &var_name)
+    {
+      return var_name + "__direct";
+    }
+
     native_persistent_string boxed_local_name(native_persistent_string const &local_name)
     {
       return local_name + "__boxed";
     }
+
+    /* Unboxed loop locals have a fixed native type. Returns the C++ type, as well as the fn
+     * used to convert a value into that type. */
+    std::pair<native_persistent_string_view, native_persistent_string_view>
+    unboxed_local_type(analyze::local_binding const &binding)
+    {
+      if(binding.unboxed_type.unwrap() == runtime::object_type::integer)
+      {
+        return { "jank::native_integer", "jank::runtime::unbox_integer" };
+      }
+      return { "jank::native_real", "jank::runtime::unbox_real" };
+    }
   }
 
   handle::handle(native_persistent_string const &name, native_bool const boxed)
@@ -594,6 +727,23 @@ namespace jank::codegen
     }
 
     auto inserter(std::back_inserter(body_buffer));
+
+    /* Each call site gets its own inline cache. It's a function local static, rather than a
+     * member, so it's shared across all instances of this fn, such as closures. Since it's
+     * constant initialized, there's no guard on it. Calls with packed args skip the cache. */
+    if(arg_tmps.size() <= runtime::max_params)
+    {
+      auto const site(runtime::context::unique_string("call_site"));
+      fmt::format_to(inserter, "static jank::runtime::call_site_cache {};", site);
+      fmt::format_to(inserter, "auto const {}({}.call({}", ret_tmp, site, source_tmp);
+      for(auto const &arg_tmp : arg_tmps)
+      {
+        fmt::format_to(inserter, ", {}", arg_tmp.str(true));
+      }
+      fmt::format_to(inserter, "));");
+      return;
+    }
+
     fmt::format_to(inserter, "auto const {}(jank::runtime::dynamic_call({}", ret_tmp, source_tmp);
     for(size_t i{}; i < runtime::max_params && i < arg_tmps.size(); ++i)
     {
@@ -613,6 +763,201 @@ namespace jank::codegen
     fmt::format_to(inserter, "));");
   }
 
+  /* Destructuring by hand is a series of `nth`, `get`, `first`, `second` and keyword calls
+   * on the same collection. Each of those dispatches on the collection's type and, for
+   * maps, scans for the key. When the analyzer knows the collection's shape, we can load
+   * straight from its storage instead:
+   *
+   * (let [v [a b]] (nth v 1))  =>  expect_object<obj::persistent_vector>(v)->data[1]
+   * (let [m {:a a}] (:a m))   =>  expect_object<obj::persistent_array_map>(m)->data.data[1]
+   *
+   * Literal shapes are exact, so the load is unconditional. Hinted shapes get a type and
+   * bounds check, falling back to the generic fn. */
+  native_bool processor::format_shaped_access(
+    analyze::expr::call<analyze::expression> const &expr,
+    native_persistent_string_view const &ret_tmp,
+    analyze::expr::function_arity<analyze::expression> const &fn_arity)
+  {
+    /* The collection is always the first arg. We need the constant being looked up in it and
+     * the generic fn which does the same thing. */
+    runtime::object_ptr key{};
+    native_persistent_string_view generic_fn;
+    native_bool is_keyword_call{};
+
+    auto const constant_arg([&](size_t const i) -> runtime::object_ptr {
+      if(expr.arg_exprs.size() <= i)
+      {
+        return nullptr;
+      }
+      auto const * const literal(
+        boost::get<analyze::expr::primitive_literal<analyze::expression>>(
+          &expr.arg_exprs[i]->data));
+      return literal ? literal->data : nullptr;
+    });
+
+    if(auto const * const literal
+       = boost::get<analyze::expr::primitive_literal<analyze::expression>>(
+         &expr.source_expr->data);
+       literal && literal->data->type == runtime::object_type::keyword)
+    {
+      key = literal->data;
+      is_keyword_call = true;
+    }
+    else if(auto const * const ref
+            = boost::get<analyze::expr::var_deref<analyze::expression>>(
+              &expr.source_expr->data);
+            ref && ref->qualified_name->ns == "clojure.core")
+    {
+      auto const &name(ref->qualified_name->name);
+      auto const arg_count(expr.arg_exprs.size());
+      if(name == "nth" && (arg_count == 2 || arg_count == 3))
+      {
+        key = constant_arg(1);
+        generic_fn = "jank::runtime::nth";
+      }
+      else if(name == "get" && (arg_count == 2 || arg_count == 3))
+      {
+        key = constant_arg(1);
+        generic_fn = "jank::runtime::get";
+      }
+      else if(name == "first" && arg_count == 1)
+      {
+        key = make_box(static_cast<native_integer>(0));
+        generic_fn = "jank::runtime::first";
+      }
+      else if(name == "second" && arg_count == 1)
+      {
+        key = make_box(static_cast<native_integer>(1));
+        generic_fn = "jank::runtime::second";
+      }
+    }
+
+    if(!key || expr.arg_exprs.empty())
+    {
+      return false;
+    }
+
+    auto const shape(analyze::find_shape(rt_ctx, expr.arg_exprs[0]));
+    if(shape.is_none())
+    {
+      return false;
+    }
+
+    auto const &coll_shape(shape.unwrap());
+    option<size_t> vector_index, map_slot;
+    native_bool keyword_get{};
+    if(coll_shape.type == analyze::value_shape::kind::vector && !is_keyword_call
+       && key->type == runtime::object_type::integer)
+    {
+      auto const i(runtime::expect_object<runtime::obj::integer>(key)->data);
+      /* Out of bounds on an exact vector is left to the generic fn, for its error. */
+      if(i < 0
+         || (coll_shape.size.is_some() && coll_shape.size.unwrap() <= static_cast<size_t>(i)))
+      {
+        return false;
+      }
+      vector_index = static_cast<size_t>(i);
+    }
+    /* Only lookups by key can load from a slot. `first`, `second`, and `nth` take positions,
+     * which aren't keys for a map, even when the map has integer keys. */
+    else if(coll_shape.type == analyze::value_shape::kind::map && coll_shape.exact
+            && coll_shape.keys.is_some()
+            && (is_keyword_call || generic_fn == "jank::runtime::get"))
+    {
+      auto const &keys(coll_shape.keys.unwrap());
+      for(size_t i{}; i < keys.size(); ++i)
+      {
+        if(runtime::detail::equal(keys[i], key))
+        {
+          map_slot = i;
+          break;
+        }
+      }
+    }
+    /* Without the slots, a keyword can still skip `get`'s dispatch, same as a keyword call. */
+    else if(coll_shape.type == analyze::value_shape::kind::map && !is_keyword_call
+            && generic_fn == "jank::runtime::get" && key->type == runtime::object_type::keyword)
+    {
+      keyword_get = true;
+    }
+
+    if(vector_index.is_none() && map_slot.is_none() && !keyword_get)
+    {
+      return false;
+    }
+
+    /* Every arg is still evaluated, in order, even though we only load from the first. */
+    native_vector<handle> arg_tmps;
+    arg_tmps.reserve(expr.arg_exprs.size());
+    for(auto const &arg_expr : expr.arg_exprs)
+    {
+      arg_tmps.emplace_back(gen(arg_expr, fn_arity, true).unwrap());
+    }
+    auto const coll_tmp(arg_tmps[0].str(true));
+
+    auto inserter(std::back_inserter(body_buffer));
+    if(keyword_get)
+    {
+      fmt::format_to(inserter,
+                     "auto const {}(jank::runtime::keyword_get({}, {}",
+                     ret_tmp,
+                     arg_tmps[1].str(true),
+                     coll_tmp);
+      if(arg_tmps.size() == 3)
+      {
+        fmt::format_to(inserter, ", {}", arg_tmps[2].str(true));
+      }
+      fmt::format_to(inserter, "));");
+    }
+    else if(map_slot.is_some())
+    {
+      /* Array map storage is interleaved keys and values. */
+      fmt::format_to(inserter,
+                     "auto const {}(jank::runtime::expect_object<jank::runtime::obj::persistent_"
+                     "array_map>({})->data.data[{}]);",
+                     ret_tmp,
+                     coll_tmp,
+                     map_slot.unwrap() * 2 + 1);
+    }
+    else if(coll_shape.exact && coll_shape.size.is_some())
+    {
+      fmt::format_to(inserter,
+                     "auto const {}(jank::runtime::expect_object<jank::runtime::obj::persistent_"
+                     "vector>({})->data[{}]);",
+                     ret_tmp,
+                     coll_tmp,
+                     vector_index.unwrap());
+    }
+    else
+    {
+      fmt::format_to(inserter,
+                     "auto const {}({}->type == jank::runtime::object_type::persistent_vector "
+                     "&& {} < jank::runtime::expect_object<jank::runtime::obj::persistent_"
+                     "vector>({})->data.size() ? jank::runtime::expect_object<jank::runtime::obj::"
+                     "persistent_vector>({})->data[{}] : {}(",
+                     ret_tmp,
+                     coll_tmp,
+                     vector_index.unwrap(),
+                     coll_tmp,
+                     coll_tmp,
+                     vector_index.unwrap(),
+                     generic_fn);
+      native_bool need_comma{};
+      for(auto const &arg_tmp : arg_tmps)
+      {
+        if(need_comma)
+        {
+          fmt::format_to(inserter, ", ");
+        }
+        fmt::format_to(inserter, "{}", arg_tmp.str(true));
+        need_comma = true;
+      }
+      fmt::format_to(inserter, "));");
+    }
+
+    return true;
+  }
+
   option<handle> processor::gen(analyze::expr::call<analyze::expression> const &expr,
                                 analyze::expr::function_arity<analyze::expression> const &fn_arity,
                                 native_bool const box_needed)
@@ -624,331 +969,106 @@ namespace jank::codegen
     /* Clojure's codegen actually skips vars for certain calls to clojure.core
      * fns; this is not the same as direct linking, which uses `invokeStatic`
      * instead. Rather, this makes calls to `get` become `RT.get`, calls to `+` become
-     * `Numbers.add`, and so on. We do the same thing here. */
+     * `Numbers.add`, and so on. We do the same thing here, driven by the var's
+     * `:inline` meta. */
     native_bool elided{};
-    /* TODO: Use the actual var meta to do this, not a hard-coded set of if checks. */
-    if(auto const * const ref
-       = boost::get<analyze::expr::var_deref<analyze::expression>>(&expr.source_expr->data))
+    if(format_shaped_access(expr, ret_tmp.str(true), fn_arity))
     {
-      if(ref->qualified_name->ns != "clojure.core")
-      {
-      }
-      else if(ref->qualified_name->equal(runtime::obj::symbol{ "clojure.core", "get" }))
+      elided = true;
+    }
+    else if(auto const * const ref
+            = boost::get<analyze::expr::var_deref<analyze::expression>>(&expr.source_expr->data))
+    {
+      auto const inline_call(detail::find_inline_call(rt_ctx, ref->var, expr.arg_exprs.size()));
+      if(inline_call.is_some())
       {
-        format_elided_var("jank::runtime::get(",
+        auto const &call(inline_call.unwrap());
+        auto const start(fmt::format("{}(", call.fn_name));
+        format_elided_var(start,
                           ")",
                           ret_tmp.str(false),
                           expr.arg_exprs,
                           fn_arity,
-                          true,
-                          false);
+                          !call.supports_unboxed_input,
+                          call.unboxed_output && box_needed);
         elided = true;
-      }
-      else if(expr.arg_exprs.empty())
-      {
-        if(ref->qualified_name->equal(runtime::obj::symbol{ "clojure.core", "rand" }))
-        {
-          format_elided_var("jank::runtime::rand(",
-                            ")",
-                            ret_tmp.str(false),
-                            expr.arg_exprs,
-                            fn_arity,
-                            false,
-                            box_needed);
-          elided = true;
-          ret_tmp = { ret_tmp.unboxed_name, box_needed };
-        }
-      }
-      else if(expr.arg_exprs.size() == 1)
-      {
-        if(ref->qualified_name->equal(runtime::obj::symbol{ "clojure.core", "print" }))
-        {
-          format_elided_var("jank::runtime::context::print(",
-                            ")",
-                            ret_tmp.str(false),
-                            expr.arg_exprs,
-                            fn_arity,
-                            true,
-                            false);
-          elided = true;
-        }
-        else if(ref->qualified_name->equal(runtime::obj::symbol{ "clojure.core", "abs" }))
+        if(call.unboxed_output)
         {
-          format_elided_var("jank::runtime::abs(",
-                            ")",
-                            ret_tmp.str(false),
-                            expr.arg_exprs,
-                            fn_arity,
-                            false,
-                            box_needed);
-          elided = true;
           ret_tmp = { ret_tmp.unboxed_name, box_needed };
         }
-        else if(ref->qualified_name->equal(runtime::obj::symbol{ "clojure.core", "sqrt" }))
-        {
-          format_elided_var("jank::runtime::sqrt(",
-                            ")",
-                            ret_tmp.str(false),
-                            expr.arg_exprs,
-                            fn_arity,
-                            false,
-                            box_needed);
-          elided = true;
-          ret_tmp = { ret_tmp.unboxed_name, box_needed };
-        }
-        else if(ref->qualified_name->equal(runtime::obj::symbol{ "clojure.core", "int" }))
-        {
-          format_elided_var("jank::runtime::to_int(",
-                            ")",
-                            ret_tmp.str(false),
-                            expr.arg_exprs,
-                            fn_arity,
-                            false,
-                            box_needed);
-          elided = true;
-          ret_tmp = { ret_tmp.unboxed_name, box_needed };
-        }
-        else if(ref->qualified_name->equal(runtime::obj::symbol{ "clojure.core", "seq" }))
-        {
-          format_elided_var("jank::runtime::seq(",
-                            ")",
-                            ret_tmp.str(false),
-                            expr.arg_exprs,
-                            fn_arity,
-                            true,
-                            false);
-          elided = true;
-        }
-        else if(ref->qualified_name->equal(runtime::obj::symbol{ "clojure.core", "fresh_seq" }))
-        {
-          format_elided_var("jank::runtime::fresh_seq(",
-                            ")",
-                            ret_tmp.str(false),
-                            expr.arg_exprs,
-                            fn_arity,
-                            true,
-                            false);
-          elided = true;
-        }
-        else if(ref->qualified_name->equal(runtime::obj::symbol{ "clojure.core", "first" }))
-        {
-          format_elided_var("jank::runtime::first(",
-                            ")",
-                            ret_tmp.str(false),
-                            expr.arg_exprs,
-                            fn_arity,
-                            true,
-                            false);
-          elided = true;
-        }
-        else if(ref->qualified_name->equal(runtime::obj::symbol{ "clojure.core", "next" }))
-        {
-          format_elided_var("jank::runtime::next(",
-                            ")",
-                            ret_tmp.str(false),
-                            expr.arg_exprs,
-                            fn_arity,
-                            true,
-                            false);
-          elided = true;
-        }
-        else if(ref->qualified_name->equal(runtime::obj::symbol{ "clojure.core", "next_in_place" }))
-        {
-          format_elided_var("jank::runtime::next_in_place(",
-                            ")",
-                            ret_tmp.str(false),
-                            expr.arg_exprs,
-                            fn_arity,
-                            true,
-                            false);
-          elided = true;
-        }
-        else if(ref->qualified_name->equal(runtime::obj::symbol{ "clojure.core", "nil?" }))
-        {
-          format_elided_var("jank::runtime::is_nil(",
-                            ")",
-                            ret_tmp.str(false),
-                            expr.arg_exprs,
-                            fn_arity,
-                            true,
-                            box_needed);
-          elided = true;
-        }
-        else if(ref->qualified_name->equal(runtime::obj::symbol{ "clojure.core", "some?" }))
-        {
-          format_elided_var("jank::runtime::is_some(",
-                            ")",
-                            ret_tmp.str(false),
-                            expr.arg_exprs,
-                            fn_arity,
-                            true,
-                            box_needed);
-          elided = true;
-        }
       }
-      else if(expr.arg_exprs.size() == 2)
+      else if(auto const * const link = detail::find_direct_link(rt_ctx, ref->var);
+              link && expr.arg_exprs.size() <= runtime::max_params
+              && link->arities.contains(expr.arg_exprs.size()))
       {
-        if(ref->qualified_name->equal(runtime::obj::symbol{ "clojure.core", "+" }))
-        {
-          format_elided_var("jank::runtime::add(",
-                            ")",
-                            ret_tmp.str(false),
-                            expr.arg_exprs,
-                            fn_arity,
-                            false,
-                            box_needed);
-          elided = true;
-          ret_tmp = { ret_tmp.unboxed_name, box_needed };
-        }
-        else if(ref->qualified_name->equal(runtime::obj::symbol{ "clojure.core", "-" }))
-        {
-          format_elided_var("jank::runtime::sub(",
-                            ")",
-                            ret_tmp.str(false),
-                            expr.arg_exprs,
-                            fn_arity,
-                            false,
-                            box_needed);
-          elided = true;
-          ret_tmp = { ret_tmp.unboxed_name, box_needed };
-        }
-        else if(ref->qualified_name->equal(runtime::obj::symbol{ "clojure.core", "*" }))
-        {
-          format_elided_var("jank::runtime::mul(",
-                            ")",
-                            ret_tmp.str(false),
-                            expr.arg_exprs,
-                            fn_arity,
-                            false,
-                            box_needed);
-          elided = true;
-          ret_tmp = { ret_tmp.unboxed_name, box_needed };
-        }
-        else if(ref->qualified_name->equal(runtime::obj::symbol{ "clojure.core", "/" }))
-        {
-          format_elided_var("jank::runtime::div(",
-                            ")",
-                            ret_tmp.str(false),
-                            expr.arg_exprs,
-                            fn_arity,
-                            false,
-                            box_needed);
-          elided = true;
-          ret_tmp = { ret_tmp.unboxed_name, box_needed };
-        }
-        else if(ref->qualified_name->equal(runtime::obj::symbol{ "clojure.core", "<" }))
-        {
-          format_elided_var("jank::runtime::lt(",
-                            ")",
-                            ret_tmp.str(false),
-                            expr.arg_exprs,
-                            fn_arity,
-                            false,
-                            box_needed);
-          elided = true;
-          ret_tmp = { ret_tmp.unboxed_name, box_needed };
-        }
-        else if(ref->qualified_name->equal(runtime::obj::symbol{ "clojure.core", "<=" }))
-        {
-          format_elided_var("jank::runtime::lte(",
-                            ")",
-                            ret_tmp.str(false),
-                            expr.arg_exprs,
-                            fn_arity,
-                            false,
-                            box_needed);
-          elided = true;
-          ret_tmp = { ret_tmp.unboxed_name, box_needed };
-        }
-        else if(ref->qualified_name->equal(runtime::obj::symbol{ "clojure.core", ">" }))
-        {
-          /* TODO: Use lt and reverse args. */
-          format_elided_var("jank::runtime::gt(",
-                            ")",
-                            ret_tmp.str(false),
-                            expr.arg_exprs,
-                            fn_arity,
-                            false,
-                            box_needed);
-          elided = true;
-          ret_tmp = { ret_tmp.unboxed_name, box_needed };
-        }
-        else if(ref->qualified_name->equal(runtime::obj::symbol{ "clojure.core", ">=" }))
-        {
-          /* TODO: Use lte and reverse args. */
-          format_elided_var("jank::runtime::gte(",
-                            ")",
-                            ret_tmp.str(false),
-                            expr.arg_exprs,
-                            fn_arity,
-                            false,
-                            box_needed);
-          elided = true;
-          ret_tmp = { ret_tmp.unboxed_name, box_needed };
-        }
-        else if(ref->qualified_name->equal(runtime::obj::symbol{ "clojure.core", "min" }))
+        /* With direct linking, we skip the var and the arity dispatch by calling into the
+         * fn's struct. If the var was rebound before we were built, we fall back to it. */
+        auto const &var(ref->frame->find_lifted_var(ref->qualified_name).unwrap().get());
+        auto const var_name(runtime::munge(var.native_name.name));
+        auto const direct_name(detail::direct_link_name(var_name));
+
+        native_vector<handle> arg_tmps;
+        arg_tmps.reserve(expr.arg_exprs.size());
+        for(auto const &arg_expr : expr.arg_exprs)
         {
-          format_elided_var("jank::runtime::min(",
-                            ")",
-                            ret_tmp.str(false),
-                            expr.arg_exprs,
-                            fn_arity,
-                            false,
-                            box_needed);
-          elided = true;
-          ret_tmp = { ret_tmp.unboxed_name, box_needed };
-        }
-        else if(ref->qualified_name->equal(runtime::obj::symbol{ "clojure.core", "max" }))
-        {
-          format_elided_var("jank::runtime::max(",
-                            ")",
-                            ret_tmp.str(false),
-                            expr.arg_exprs,
-                            fn_arity,
-                            false,
-                            box_needed);
-          elided = true;
-          ret_tmp = { ret_tmp.unboxed_name, box_needed };
-        }
-        else if(ref->qualified_name->equal(runtime::obj::symbol{ "clojure.core", "pow" }))
-        {
-          format_elided_var("jank::runtime::pow(",
-                            ")",
-                            ret_tmp.str(false),
-                            expr.arg_exprs,
-                            fn_arity,
-                            false,
-                            box_needed);
-          elided = true;
-          ret_tmp = { ret_tmp.unboxed_name, box_needed };
+          arg_tmps.emplace_back(gen(arg_expr, fn_arity, true).unwrap());
         }
-        else if(ref->qualified_name->equal(runtime::obj::symbol{ "clojure.core", "conj" }))
+
+        /* The struct's `call` overrides are final, so this isn't a virtual call. */
+        fmt::format_to(inserter,
+                       "auto const {}({} ? {}->call(",
+                       ret_tmp.str(true),
+                       direct_name,
+                       direct_name);
+        native_bool need_comma{};
+        for(auto const &arg_tmp : arg_tmps)
         {
-          format_elided_var("jank::runtime::conj(",
-                            ")",
-                            ret_tmp.str(false),
-                            expr.arg_exprs,
-                            fn_arity,
-                            true,
-                            false);
-          elided = true;
+          if(need_comma)
+          {
+            fmt::format_to(inserter, ", ");
+          }
+          fmt::format_to(inserter, "{}", arg_tmp.str(true));
+          need_comma = true;
         }
-      }
-      else if(expr.arg_exprs.size() == 3)
-      {
-        if(ref->qualified_name->equal(runtime::obj::symbol{ "clojure.core", "assoc" }))
+        fmt::format_to(inserter, ") : jank::runtime::dynamic_call({}->deref()", var_name);
+        for(auto const &arg_tmp : arg_tmps)
         {
-          format_elided_var("jank::runtime::assoc(",
-                            ")",
-                            ret_tmp.str(false),
-                            expr.arg_exprs,
-                            fn_arity,
-                            true,
-                            false);
-          elided = true;
+          fmt::format_to(inserter, ", {}", arg_tmp.str(true));
         }
+        fmt::format_to(inserter, "));");
+        elided = true;
       }
     }
+    else if(auto const * const literal
+            = boost::get<analyze::expr::primitive_literal<analyze::expression>>(
+              &expr.source_expr->data);
+            literal && literal->data->type == runtime::object_type::keyword)
+    {
+      /* `(:k m)` skips the keyword's `call` and goes straight to the map. The analyzer
+       * has already checked the arity. */
+      auto const &keyword_tmp(gen(expr.source_expr, fn_arity, true).unwrap());
+      format_elided_var(fmt::format("jank::runtime::keyword_get({}, ", keyword_tmp.str(true)),
+                        ")",
+                        ret_tmp.str(false),
+                        expr.arg_exprs,
+                        fn_arity,
+                        true,
+                        false);
+      elided = true;
+    }
+    else if(auto const * const local
+            = boost::get<analyze::expr::local_reference>(&expr.source_expr->data);
+            local && local->binding.is_stack_allocated)
+    {
+      /* The analyzer only puts a fn on the stack if each of its calls matches a fixed arity,
+       * so we can call straight into its struct. */
+      format_direct_call(runtime::munge(local->name->name),
+                         ret_tmp.str(true),
+                         expr.arg_exprs,
+                         fn_arity,
+                         true);
+      elided = true;
+    }
     else if(auto const * const fn
             = boost::get<analyze::expr::function<analyze::expression>>(&expr.source_expr->data))
     {
@@ -1218,6 +1338,7 @@ namespace jank::codegen
                    expr,
                    runtime::module::nest_module(module, runtime::munge(expr.name)),
                    compiling ? compilation_target::function : compilation_target::repl };
+    has_nested_fns = true;
 
     /* If we're compiling, we'll create a separate file for this. */
     if(target != compilation_target::ns)
@@ -1249,17 +1370,66 @@ namespace jank::codegen
   {
     auto inserter(std::back_inserter(body_buffer));
 
-    native_vector<handle> arg_tmps;
+    /* Every arg is evaluated before anything is rebound, since args may refer to the
+     * current values of the params, like in (recur b a). */
+    native_vector<native_persistent_string> arg_tmps;
     arg_tmps.reserve(expr.arg_exprs.size());
+
+    if(expr.loop_ctx.is_none())
+    {
+      for(auto const &arg_expr : expr.arg_exprs)
+      {
+        auto const arg_tmp(gen(arg_expr, fn_arity, true).unwrap());
+        auto const &tmp(arg_tmps.emplace_back(runtime::context::unique_string("recur")));
+        fmt::format_to(inserter, "auto const {}({});", tmp, arg_tmp.str(true));
+      }
+
+      auto arg_tmp_it(arg_tmps.begin());
+      for(auto const &param : fn_arity.params)
+      {
+        fmt::format_to(inserter, "{} = {};", runtime::munge(param->name), *arg_tmp_it);
+        ++arg_tmp_it;
+      }
+      fmt::format_to(inserter, "continue;");
+      return none;
+    }
+
+    auto const &loop_ctx(expr.loop_ctx.unwrap());
+    auto const &loop_frame(loop_ctx->loop_frame.unwrap());
+    auto param_it(loop_ctx->loop_params.begin());
     for(auto const &arg_expr : expr.arg_exprs)
     {
-      arg_tmps.emplace_back(gen(arg_expr, fn_arity, true).unwrap());
+      auto const &binding(loop_frame->locals.find(*param_it)->second);
+      auto const arg_tmp(gen(arg_expr, fn_arity, binding.needs_box).unwrap());
+      auto const &tmp(arg_tmps.emplace_back(runtime::context::unique_string("recur")));
+      fmt::format_to(inserter, "auto const {}({});", tmp, arg_tmp.str(binding.needs_box));
+      ++param_it;
     }
 
     auto arg_tmp_it(arg_tmps.begin());
-    for(auto const &param : fn_arity.params)
+    for(auto const &param : loop_ctx->loop_params)
     {
-      fmt::format_to(inserter, "{} = {};", runtime::munge(param->name), arg_tmp_it->str(true));
+      auto const &binding(loop_frame->locals.find(param)->second);
+      auto const munged_name(runtime::munge(param->name));
+      if(binding.needs_box)
+      {
+        fmt::format_to(inserter, "{} = {};", munged_name, *arg_tmp_it);
+      }
+      else
+      {
+        fmt::format_to(inserter,
+                       "{} = {}({});",
+                       munged_name,
+                       detail::unboxed_local_type(binding).second,
+                       *arg_tmp_it);
+        if(binding.has_boxed_usage)
+        {
+          fmt::format_to(inserter,
+                         "{} = jank::make_box({});",
+                         detail::boxed_local_name(munged_name),
+                         munged_name);
+        }
+      }
       ++arg_tmp_it;
     }
     fmt::format_to(inserter, "continue;");
@@ -1270,6 +1440,11 @@ namespace jank::codegen
                                 analyze::expr::function_arity<analyze::expression> const &fn_arity,
                                 native_bool const)
   {
+    if(expr.is_loop)
+    {
+      return gen_loop(expr, fn_arity);
+    }
+
     auto inserter(std::back_inserter(body_buffer));
     handle ret_tmp{ runtime::context::unique_string("let"), expr.needs_box };
 
@@ -1289,19 +1464,22 @@ namespace jank::codegen
 
     for(auto const &pair : expr.pairs)
     {
-      auto const &val_tmp(gen(pair.second, fn_arity, pair.second->get_base()->needs_box));
-      auto const &munged_name(runtime::munge(pair.first->name));
-      /* Every binding is wrapped in its own scope, to allow shadowing. */
-      fmt::format_to(inserter, "{{ auto const {}({}); ", munged_name, val_tmp.unwrap().str(false));
-
       auto const local(expr.frame->find_local_or_capture(pair.first));
       if(local.is_none())
       {
         throw std::runtime_error{ fmt::format("ICE: unable to find local: {}",
                                               pair.first->to_string()) };
       }
-
       auto const &binding(local.unwrap().binding);
+
+      /* Fns which can't escape are built on the stack, by value. */
+      auto const &val_tmp(gen(pair.second,
+                              fn_arity,
+                              !binding.is_stack_allocated && pair.second->get_base()->needs_box));
+      auto const &munged_name(runtime::munge(pair.first->name));
+      /* Every binding is wrapped in its own scope, to allow shadowing. */
+      fmt::format_to(inserter, "{{ auto const {}({}); ", munged_name, val_tmp.unwrap().str(false));
+
       if(!binding.needs_box && binding.has_boxed_usage)
       {
         fmt::format_to(inserter,
@@ -1355,6 +1533,82 @@ namespace jank::codegen
     return ret_tmp;
   }
 
+  /* Loops generate into a while(true) around mutable locals, which recur rebinds before a
+   * continue. Unboxed loop locals become native C++ locals, with a boxed copy only if
+   * something needs it. The tail forms of a loop always return, so a loop which isn't in
+   * return position is wrapped in an IIFE. */
+  option<handle>
+  processor::gen_loop(analyze::expr::let<analyze::expression> const &expr,
+                      analyze::expr::function_arity<analyze::expression> const &fn_arity)
+  {
+    auto inserter(std::back_inserter(body_buffer));
+    native_bool const is_return{ expr.expr_type == analyze::expression_type::return_statement };
+    auto const ret_tmp(runtime::context::unique_string("loop"));
+
+    if(!is_return)
+    {
+      fmt::format_to(inserter, "auto const {}([&]() -> jank::runtime::object_ptr {{", ret_tmp);
+    }
+    fmt::format_to(inserter, "{{");
+
+    for(auto const &pair : expr.pairs)
+    {
+      auto const local(expr.frame->find_local_or_capture(pair.first));
+      if(local.is_none())
+      {
+        throw std::runtime_error{ fmt::format("ICE: unable to find local: {}",
+                                              pair.first->to_string()) };
+      }
+
+      auto const &binding(local.unwrap().binding);
+      auto const &val_tmp(gen(pair.second, fn_arity, pair.second->get_base()->needs_box));
+      auto const &munged_name(runtime::munge(pair.first->name));
+
+      if(binding.needs_box)
+      {
+        fmt::format_to(inserter,
+                       "jank::runtime::object_ptr {}({});",
+                       munged_name,
+                       val_tmp.unwrap().str(true));
+      }
+      else
+      {
+        auto const type(detail::unboxed_local_type(binding));
+        fmt::format_to(inserter,
+                       "{} {}({}({}));",
+                       type.first,
+                       munged_name,
+                       type.second,
+                       val_tmp.unwrap().str(false));
+        if(binding.has_boxed_usage)
+        {
+          fmt::format_to(inserter,
+                         "auto {}(jank::make_box({}));",
+                         detail::boxed_local_name(munged_name),
+                         munged_name);
+        }
+      }
+    }
+
+    fmt::format_to(inserter, "while(true) {{");
+    for(auto const &form : expr.body.body)
+    {
+      gen(form, fn_arity, true);
+    }
+    if(expr.body.body.empty())
+    {
+      fmt::format_to(inserter, "return jank::runtime::obj::nil::nil_const();");
+    }
+    fmt::format_to(inserter, "}} }}");
+
+    if(!is_return)
+    {
+      fmt::format_to(inserter, "}}());");
+      return ret_tmp;
+    }
+    return none;
+  }
+
   option<handle> processor::gen(analyze::expr::do_<analyze::expression> const &expr,
                                 analyze::expr::function_arity<analyze::expression> const &arity,
                                 native_bool const)
@@ -1396,6 +1650,8 @@ namespace jank::codegen
     auto inserter(std::back_inserter(body_buffer));
     auto ret_tmp(runtime::context::unique_string("if"));
     fmt::format_to(inserter, "object_ptr {}{{ obj::nil::nil_const() }};", ret_tmp);
+    /* The condition is generated unboxed, so elided predicates like `<` and `nil?` give us a
+     * native bool which truthy passes straight through. */
     auto const &condition_tmp(gen(expr.condition, fn_arity, false));
     fmt::format_to(inserter,
                    "if(jank::runtime::detail::truthy({})) {{",
@@ -1433,6 +1689,106 @@ namespace jank::codegen
     return ret_tmp;
   }
 
+  option<handle> processor::gen(analyze::expr::case_<analyze::expression> const &expr,
+                                analyze::expr::function_arity<analyze::expression> const &fn_arity,
+                                native_bool const)
+  {
+    auto inserter(std::back_inserter(body_buffer));
+    auto ret_tmp(runtime::context::unique_string("case"));
+    auto const value_tmp(runtime::context::unique_string("case_value"));
+    auto const branch_tmp(runtime::context::unique_string("case_branch"));
+    fmt::format_to(inserter, "object_ptr {}{{ obj::nil::nil_const() }};", ret_tmp);
+
+    auto const &value_expr_tmp(gen(expr.value_expr, fn_arity, true));
+    fmt::format_to(inserter,
+                   "{{ object_ptr const {}{{ {} }};",
+                   value_tmp,
+                   value_expr_tmp.unwrap().str(true));
+
+    /* We find the branch with one switch and then jump to it with another. Both are dense
+     * enough for the C++ compiler to turn into jump tables and it means each branch is only
+     * generated once, even when it has many tests. Branch 0 is the default. */
+    fmt::format_to(inserter, "size_t {}{{}};", branch_tmp);
+    if(expr.all_integers)
+    {
+      fmt::format_to(inserter,
+                     "if({}->type == jank::runtime::object_type::integer) {{"
+                     "switch(jank::runtime::expect_object<jank::runtime::obj::integer>({})->data) "
+                     "{{",
+                     value_tmp,
+                     value_tmp);
+      for(auto const &test : expr.tests)
+      {
+        fmt::format_to(inserter,
+                       "case {}: {} = {}; break;",
+                       runtime::expect_object<runtime::obj::integer>(test.first)->data,
+                       branch_tmp,
+                       test.second + 1);
+      }
+      fmt::format_to(inserter, "}} }}");
+    }
+    else
+    {
+      /* Tests are bucketed by their hash, which we know now, since they're constants. Within
+       * a bucket, which is almost always just one test, we check equality to be sure. */
+      std::map<native_hash, native_vector<std::pair<runtime::object_ptr, size_t>>> buckets;
+      for(auto const &test : expr.tests)
+      {
+        buckets[hash::visit(test.first.data)].emplace_back(test);
+      }
+
+      fmt::format_to(inserter, "switch(jank::hash::visit({}.data)) {{", value_tmp);
+      for(auto const &bucket : buckets)
+      {
+        fmt::format_to(inserter, "case {}u:", bucket.first);
+        for(auto const &test : bucket.second)
+        {
+          auto const &constant(expr.frame->find_lifted_constant(test.first).unwrap().get());
+          fmt::format_to(inserter,
+                         "if(jank::runtime::detail::equal({}, {})) {{ {} = {}; break; }}",
+                         value_tmp,
+                         constant.native_name.name,
+                         branch_tmp,
+                         test.second + 1);
+        }
+        fmt::format_to(inserter, "break;");
+      }
+      fmt::format_to(inserter, "}}");
+    }
+
+    fmt::format_to(inserter, "switch({}) {{", branch_tmp);
+    for(size_t i{}; i < expr.branches.size(); ++i)
+    {
+      fmt::format_to(inserter, "case {}: {{", i + 1);
+      auto const &then_tmp(gen(expr.branches[i], fn_arity, true));
+      if(then_tmp.is_some())
+      {
+        fmt::format_to(inserter,
+                       "{} = {};",
+                       ret_tmp,
+                       then_tmp.unwrap().str(expr.needs_box));
+      }
+      fmt::format_to(inserter, "}} break;");
+    }
+    fmt::format_to(inserter, "default: {{");
+    auto const &default_tmp(gen(expr.default_expr, fn_arity, true));
+    if(default_tmp.is_some())
+    {
+      fmt::format_to(inserter, "{} = {};", ret_tmp, default_tmp.unwrap().str(expr.needs_box));
+    }
+    fmt::format_to(inserter, "}} }} }}");
+
+    /* Branches in return position will have already returned, but this also covers us when
+     * we've been wrapped for evaluation and the branches don't know they're returning. */
+    if(expr.expr_type == analyze::expression_type::return_statement)
+    {
+      fmt::format_to(inserter, "return {};", ret_tmp);
+      return none;
+    }
+
+    return ret_tmp;
+  }
+
   option<handle> processor::gen(analyze::expr::throw_<analyze::expression> const &expr,
                                 analyze::expr::function_arity<analyze::expression> const &fn_arity,
                                 native_bool const)
@@ -1560,12 +1916,13 @@ namespace jank::codegen
   void processor::build_header()
   {
     auto inserter(std::back_inserter(header_buffer));
+    auto const nested(runtime::module::is_nested_module(module));
 
     /* TODO: We don't want this for nested modules, but we do if they're in their own file.
      * Do we need three module compilation targets? Top-level, nested, local?
      *
      * Local fns are within a struct already, so we can't enter the ns again. */
-    if(!runtime::module::is_nested_module(module))
+    if(!nested)
     {
       fmt::format_to(inserter, "namespace {} {{", runtime::module::module_to_native_ns(module));
     }
@@ -1579,7 +1936,8 @@ namespace jank::codegen
                    runtime::munge(struct_name.name));
 
     {
-      /* TODO: Constants and vars are not shared across arities. We'd need stable names. */
+      /* The analyzer gives arities the same names for the same vars and constants, so
+       * deduping on those names leaves one slot for each, for the whole fn. */
       native_set<native_integer> used_vars, used_constants, used_captures;
       for(auto const &arity : root_fn.arities)
       {
@@ -1594,6 +1952,15 @@ namespace jank::codegen
           fmt::format_to(inserter,
                          "jank::runtime::var_ptr const {0};",
                          runtime::munge(v.second.native_name.name));
+
+          auto const * const link(detail::find_direct_link(rt_ctx, v.second.var_name));
+          if(link)
+          {
+            fmt::format_to(inserter,
+                           "{} * const {};",
+                           link->native_type,
+                           detail::direct_link_name(runtime::munge(v.second.native_name.name)));
+          }
         }
 
         for(auto const &v : arity.frame->lifted_constants)
@@ -1609,6 +1976,20 @@ namespace jank::codegen
                          detail::gen_constant_type(v.second.data, true),
                          runtime::munge(v.second.native_name.name));
 
+          /* Local fns are constructed every time their enclosing fn runs, so their
+           * constants are interned just once, on first use. */
+          if(nested && detail::is_interned_constant(v.second.data))
+          {
+            fmt::format_to(inserter,
+                           "static {0} {1}{2}(jank::runtime::context &__rt_ctx)"
+                           "{{ static auto const &c(__rt_ctx.intern_static_constant(",
+                           detail::gen_constant_type(v.second.data, true),
+                           runtime::munge(v.second.native_name.name),
+                           detail::static_constant_suffix);
+            detail::gen_constant(v.second.data, header_buffer, true);
+            fmt::format_to(inserter, ")); return c; }}");
+          }
+
           if(v.second.unboxed_native_name.is_some())
           {
             fmt::format_to(inserter,
@@ -1679,6 +2060,17 @@ namespace jank::codegen
                          runtime::munge(v.second.native_name.name),
                          v.second.var_name->ns,
                          v.second.var_name->name);
+
+          /* The var member is declared, and so initialized, just before this one. */
+          auto const * const link(detail::find_direct_link(rt_ctx, v.second.var_name));
+          if(link)
+          {
+            fmt::format_to(inserter,
+                           ", {0}{{ jank::runtime::direct_link<{1}>({2}) }}",
+                           detail::direct_link_name(runtime::munge(v.second.native_name.name)),
+                           link->native_type,
+                           runtime::munge(v.second.native_name.name));
+          }
         }
 
         for(auto const &v : arity.frame->lifted_constants)
@@ -1689,8 +2081,26 @@ namespace jank::codegen
           }
           used_constants.emplace(v.second.native_name.to_hash());
 
+          auto const interned(detail::is_interned_constant(v.second.data));
+          if(nested && interned)
+          {
+            fmt::format_to(inserter,
+                           ", {0}{{ {0}{1}(__rt_ctx) }}",
+                           runtime::munge(v.second.native_name.name),
+                           detail::static_constant_suffix);
+            continue;
+          }
+
           fmt::format_to(inserter, ", {0}{{", runtime::munge(v.second.native_name.name));
+          if(interned)
+          {
+            fmt::format_to(inserter, "__rt_ctx.intern_constant(");
+          }
           detail::gen_constant(v.second.data, header_buffer, true);
+          if(interned)
+          {
+            fmt::format_to(inserter, ")");
+          }
           fmt::format_to(inserter, "}}");
         }
 
@@ -1733,6 +2143,7 @@ namespace jank::codegen
       {
         recur_suffix = detail::recur_suffix;
       }
+      auto const escaping_rest(detail::escaping_rest_param(arity));
 
       fmt::format_to(inserter, "jank::runtime::object_ptr call(");
       native_bool param_comma{};
@@ -1742,7 +2153,8 @@ namespace jank::codegen
                        "{} jank::runtime::object_ptr const {}{}",
                        (param_comma ? ", " : ""),
                        runtime::munge(param->name),
-                       recur_suffix);
+                       (param == escaping_rest && recur_suffix.empty() ? detail::rest_suffix
+                                                                       : recur_suffix));
         param_comma = true;
       }
 
@@ -1754,6 +2166,13 @@ namespace jank::codegen
         )");
 
       fmt::format_to(inserter, "jank::profile::timer __timer{{ \"{}\" }};", root_fn.name);
+      /* Only when sampling, so that fn calls don't pay for it otherwise. */
+      if(profile::alloc_sampling)
+      {
+        fmt::format_to(inserter,
+                       "jank::profile::alloc_scope const __alloc_scope{{ \"{}\" }};",
+                       root_fn.name);
+      }
 
       if(arity.fn_ctx->is_tail_recursive)
       {
@@ -1761,6 +2180,14 @@ namespace jank::codegen
 
         for(auto const &param : arity.params)
         {
+          if(param == escaping_rest)
+          {
+            fmt::format_to(inserter,
+                           "auto {0}(jank::runtime::materialize_rest({0}{1}));",
+                           runtime::munge(param->name),
+                           recur_suffix);
+            continue;
+          }
           fmt::format_to(inserter, "auto {0}({0}{1});", runtime::munge(param->name), recur_suffix);
         }
 
@@ -1770,6 +2197,13 @@ namespace jank::codegen
             {{
           )");
       }
+      else if(escaping_rest)
+      {
+        fmt::format_to(inserter,
+                       "auto const {0}(jank::runtime::materialize_rest({0}{1}));",
+                       runtime::munge(escaping_rest->name),
+                       detail::rest_suffix);
+      }
 
       for(auto const &form : arity.body.body)
       {
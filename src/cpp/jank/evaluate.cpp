@@ -5,6 +5,7 @@
 #include <jank/runtime/obj/persistent_vector.hpp>
 #include <jank/runtime/obj/number.hpp>
 #include <jank/runtime/util.hpp>
+#include <jank/runtime/seq.hpp>
 #include <jank/codegen/processor.hpp>
 #include <jank/jit/processor.hpp>
 #include <jank/evaluate.hpp>
@@ -98,6 +99,42 @@ namespace jank::evaluate
     return ret;
   }
 
+  /* Once a var is bound to a fn we JIT compiled, we know the type of its struct, so later
+   * calls can be linked straight to it. */
+  static void register_direct_link(runtime::context &rt_ctx,
+                                   runtime::var_ptr const var,
+                                   analyze::expression_ptr const &value)
+  {
+    auto const * const fn(boost::get<analyze::expr::function<analyze::expression>>(&value->data));
+    auto const redef(rt_ctx.intern_keyword("", "redef", true).expect_ok());
+    if(!fn || var->dynamic.load()
+       || (var->meta.is_some() && runtime::detail::truthy(runtime::get(var->meta.unwrap(), redef))))
+    {
+      return;
+    }
+
+    /* This matches the module used when evaluating the fn, below. */
+    auto const &module(runtime::module::nest_module(
+      runtime::expect_object<runtime::ns>(
+        rt_ctx.intern_var("clojure.core", "*ns*").expect_ok()->deref())
+        ->to_string(),
+      runtime::munge(fn->name)));
+
+    runtime::context::direct_link_target target{
+      runtime::module::nest_native_ns(runtime::module::module_to_native_ns(module),
+                                      runtime::munge(fn->name)),
+      {}
+    };
+    for(auto const &arity : fn->arities)
+    {
+      if(!arity.fn_ctx->is_variadic)
+      {
+        target.arities.emplace(arity.fn_ctx->param_count);
+      }
+    }
+    rt_ctx.direct_link_targets.insert_or_assign(var, std::move(target));
+  }
+
   runtime::object_ptr eval(runtime::context &rt_ctx,
                            jit::processor const &jit_prc,
                            analyze::expr::def<analyze::expression> const &expr)
@@ -108,8 +145,17 @@ namespace jank::evaluate
       return var;
     }
 
+    /* Drop any stale target first, so a fn calling itself while being redefined doesn't
+     * get linked to its previous definition. */
+    rt_ctx.direct_link_targets.erase(var);
+
     auto const evaluated_value(eval(rt_ctx, jit_prc, expr.value.unwrap()));
     var->bind_root(evaluated_value);
+
+    if(rt_ctx.direct_linking)
+    {
+      register_direct_link(rt_ctx, var, expr.value.unwrap());
+    }
     return var;
   }
 
@@ -446,6 +492,13 @@ namespace jank::evaluate
     return runtime::obj::nil::nil_const();
   }
 
+  runtime::object_ptr eval(runtime::context &rt_ctx,
+                           jit::processor const &jit_prc,
+                           analyze::expr::case_<analyze::expression> const &expr)
+  {
+    return runtime::dynamic_call(eval(rt_ctx, jit_prc, wrap_expression(expr)));
+  }
+
   runtime::object_ptr eval(runtime::context &rt_ctx,
                            jit::processor const &jit_prc,
                            analyze::expr::throw_<analyze::expression> const &expr)
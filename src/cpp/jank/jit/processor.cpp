@@ -1,5 +1,9 @@
+#include <atomic>
 #include <cstdlib>
 
+#include <gc/gc.h>
+
+#include <cling/Interpreter/Transaction.h>
 #include <cling/Interpreter/Value.h>
 #include <clang/AST/Type.h>
 //#include <Interpreter/IncrementalExecutor.h>
@@ -7,10 +11,68 @@
 
 #include <jank/util/process_location.hpp>
 #include <jank/util/make_array.hpp>
+#include <jank/runtime/context.hpp>
+#include <jank/runtime/call_site_cache.hpp>
 #include <jank/jit/processor.hpp>
 
+namespace jank::runtime
+{
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+  std::atomic<uint32_t> code_epoch{};
+}
+
 namespace jank::jit
 {
+  struct code_counters
+  {
+    std::atomic<size_t> declared_units{};
+    std::atomic<size_t> declared_bytes{};
+    std::atomic<size_t> unreachable_units{};
+    std::atomic<size_t> unloaded_units{};
+    std::atomic<size_t> unloaded_bytes{};
+  };
+
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+  static code_counters counters;
+  /* How many `entry` instances are held, across all threads. */
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+  static std::atomic<size_t> entries;
+
+  entry::entry()
+  {
+    ++entries;
+  }
+
+  entry::~entry()
+  {
+    --entries;
+  }
+
+  code_stats current_code_stats()
+  {
+    return { counters.declared_units.load(),
+             counters.declared_bytes.load(),
+             counters.unreachable_units.load(),
+             counters.unloaded_units.load(),
+             counters.unloaded_bytes.load() };
+  }
+
+  struct watched_unit
+  {
+    std::shared_ptr<unreachable_units> queue;
+    code_unit unit;
+  };
+
+  /* This runs once the fn is unreachable. Its code may still be running, though, so the unit
+   * is only queued, to be unloaded at the next safe point. */
+  static void on_unreachable(void * const, void * const data)
+  {
+    std::unique_ptr<watched_unit> const watched{ static_cast<watched_unit *>(data) };
+    std::lock_guard<std::mutex> const lock{ watched->queue->mutex };
+    watched->queue->units.push_back(watched->unit);
+    ++counters.unreachable_units;
+  }
+
   option<boost::filesystem::path> find_pch()
   {
     auto const jank_path(jank::util::process_location().unwrap().parent_path());
@@ -144,7 +206,13 @@ namespace jank::jit
     auto const str(cg_prc.declaration_str());
     //fmt::println("{}", str);
 
-    interpreter->declare(static_cast<std::string>(cg_prc.declaration_str()));
+    auto const * const previous(interpreter->getLastTransaction());
+    auto const declared(interpreter->declare(static_cast<std::string>(str)));
+    if(declared == cling::Interpreter::CompilationResult::kSuccess)
+    {
+      ++counters.declared_units;
+      counters.declared_bytes += str.size();
+    }
 
     auto const expr(cg_prc.expression_str(true));
     if(expr.empty())
@@ -162,12 +230,92 @@ namespace jank::jit
 
     // clang::QualType::getFromOpaquePtr(v.m_Type).getAsString()
     auto const ret_val(v.castAs<runtime::object *>());
+
+    /* Once this fn is unreachable, so is the code declared for it, unless other code refers
+     * to it. That's the case for nested fns, whose instances can escape, and for direct
+     * linking, where callers name this fn's struct in their own code. Each var's previous
+     * fn becomes unreachable once the var is redefined and nothing else holds onto it.
+     * The most common case, though, is the fn wrapping each REPL input, which is unreachable
+     * as soon as it has run. */
+    auto * const fn_base(GC_base(ret_val));
+    if(previous && fn_base && declared == cling::Interpreter::CompilationResult::kSuccess
+       && !cg_prc.has_nested_fns && !cg_prc.rt_ctx.direct_linking
+       && cg_prc.target == codegen::compilation_target::repl)
+    {
+      code_unit const unit{ previous, interpreter->getLastTransaction(), str.size() };
+      GC_register_finalizer_no_order(fn_base,
+                                     &on_unreachable,
+                                     new watched_unit{ unreachable, unit },
+                                     nullptr,
+                                     nullptr);
+    }
+
     return ok(ret_val);
   }
 
+  native_bool processor::unload_unreachable() const
+  {
+    if(entries.load() != 0)
+    {
+      return false;
+    }
+
+    /* The queue isn't locked while unloading, since the GC may run finalizers, which
+     * lock it, while Cling allocates. */
+    std::vector<code_unit> units;
+    {
+      std::lock_guard<std::mutex> const lock{ unreachable->mutex };
+      units.swap(unreachable->units);
+    }
+    if(units.empty())
+    {
+      return true;
+    }
+
+    profile::timer timer{ "jit unload" };
+    native_bool unloaded{};
+    for(auto found(true); found;)
+    {
+      found = false;
+      auto const * const latest(interpreter->getLastTransaction());
+      for(auto it(units.begin()); it != units.end(); ++it)
+      {
+        if(it->last != latest)
+        {
+          continue;
+        }
+
+        while(interpreter->getLastTransaction() != it->previous)
+        {
+          interpreter->unload(1);
+        }
+        --counters.unreachable_units;
+        ++counters.unloaded_units;
+        counters.unloaded_bytes += it->bytes;
+
+        units.erase(it);
+        found = unloaded = true;
+        break;
+      }
+    }
+
+    if(unloaded)
+    {
+      ++runtime::code_epoch;
+    }
+
+    if(!units.empty())
+    {
+      std::lock_guard<std::mutex> const lock{ unreachable->mutex };
+      unreachable->units.insert(unreachable->units.end(), units.begin(), units.end());
+    }
+    return true;
+  }
+
   void processor::eval_string(native_persistent_string const &s) const
   {
     jank::profile::timer timer{ "jit eval_string" };
+    entry const running;
     //fmt::println("JIT eval string {}", s);
     interpreter->process(static_cast<std::string>(s));
   }
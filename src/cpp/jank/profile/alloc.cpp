@@ -0,0 +1,148 @@
+#include <atomic>
+#include <csignal>
+#include <cstdlib>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <fmt/ostream.h>
+#include <magic_enum.hpp>
+
+#include <jank/profile/alloc.hpp>
+#include <jank/runtime/object.hpp>
+#include <jank/util/cli.hpp>
+
+namespace jank::profile
+{
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+  bool alloc_sampling{};
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+  static size_t sample_rate{};
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+  static std::string output_file;
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+  static std::atomic_bool dump_requested{};
+
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+  static thread_local size_t countdown{};
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+  static thread_local alloc_scope const *current_scope{};
+
+  /* Each sample stands in for `sample_rate` allocations, so the bytes are scaled up. Samples
+   * are keyed by their folded stack. None of this uses the GC, so recording a sample can't
+   * lead to another one. */
+  struct sample_totals
+  {
+    size_t count{};
+    size_t bytes{};
+  };
+
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+  static std::mutex samples_mutex;
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+  static std::unordered_map<std::string, sample_totals> samples;
+
+  alloc_scope::alloc_scope(char const * const name)
+    : name{ name }
+    , previous{ current_scope }
+  {
+    current_scope = this;
+  }
+
+  alloc_scope::~alloc_scope()
+  {
+    current_scope = previous;
+  }
+
+  /* Folded stacks go from the outermost frame in, separated by semicolons, and end with
+   * the type which was allocated. */
+  static std::string folded_stack(std::string_view const &label)
+  {
+    std::vector<char const *> names;
+    for(auto scope(current_scope); scope; scope = scope->previous)
+    {
+      names.push_back(scope->name);
+    }
+    if(names.empty())
+    {
+      names.push_back("[native]");
+    }
+
+    std::string ret;
+    for(auto it(names.rbegin()); it != names.rend(); ++it)
+    {
+      ret += *it;
+      ret += ';';
+    }
+    ret += '[';
+    ret += label;
+    ret += ']';
+    return ret;
+  }
+
+  void count_allocation(runtime::object_type const type, size_t const size)
+  {
+    count_allocation(magic_enum::enum_name(type), size);
+  }
+
+  void count_allocation(std::string_view const &label, size_t const size)
+  {
+    if(++countdown < sample_rate)
+    {
+      return;
+    }
+    countdown = 0;
+
+    auto stack(folded_stack(label));
+    {
+      std::lock_guard<std::mutex> const lock{ samples_mutex };
+      auto &totals(samples[std::move(stack)]);
+      ++totals.count;
+      totals.bytes += size * sample_rate;
+    }
+
+    if(dump_requested.exchange(false))
+    {
+      dump_allocations();
+    }
+  }
+
+  /* Writing a file isn't safe from within a signal handler, so we just flag it. */
+  static void request_dump(int)
+  {
+    dump_requested.store(true);
+  }
+
+  void configure_alloc(util::cli::options const &opts)
+  {
+    if(opts.alloc_sample_rate <= 0)
+    {
+      return;
+    }
+
+    sample_rate = static_cast<size_t>(opts.alloc_sample_rate);
+    output_file = opts.alloc_profile_file;
+    alloc_sampling = true;
+
+    std::signal(SIGUSR2, &request_dump);
+    std::atexit(&dump_allocations);
+  }
+
+  void dump_allocations()
+  {
+    std::lock_guard<std::mutex> const lock{ samples_mutex };
+    std::ofstream output{ output_file };
+    if(!output.is_open())
+    {
+      fmt::println(stderr, "Unable to open allocation profile file: {}", output_file);
+      return;
+    }
+
+    for(auto const &sample : samples)
+    {
+      fmt::println(output, "{} {}", sample.first, sample.second.bytes);
+    }
+  }
+}
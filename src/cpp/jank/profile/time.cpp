@@ -1,4 +1,8 @@
+#include <cstdlib>
+
 #include <jank/profile/time.hpp>
+#include <jank/runtime/gc.hpp>
+#include <jank/jit/processor.hpp>
 
 namespace jank::profile
 {
@@ -27,7 +31,10 @@ namespace jank::profile
         fmt::println(stderr,
                      "Unable to open profile file: {}\nProfiling is now disabled.",
                      opts.profiler_file);
+        return;
       }
+
+      std::atexit(&report_summary);
     }
   }
 
@@ -55,6 +62,40 @@ namespace jank::profile
     }
   }
 
+  void report_summary()
+  {
+    if(enabled)
+    {
+      auto const gc(runtime::current_gc_stats());
+      fmt::println(output,
+                   "{} {} gc heap-size {} free-ratio {:.3f} total-bytes {} collections {} "
+                   "last-pause {} p50-pause {} p90-pause {} p99-pause {} max-pause {}",
+                   tag,
+                   now(),
+                   gc.heap_size,
+                   gc.free_ratio,
+                   gc.total_bytes + gc.bytes_since_gc,
+                   gc.collections,
+                   gc.last_pause,
+                   gc.p50_pause,
+                   gc.p90_pause,
+                   gc.p99_pause,
+                   gc.max_pause);
+
+      auto const jit(jit::current_code_stats());
+      fmt::println(output,
+                   "{} {} jit declared-units {} declared-bytes {} unreachable-units {} "
+                   "unloaded-units {} unloaded-bytes {}",
+                   tag,
+                   now(),
+                   jit.declared_units,
+                   jit.declared_bytes,
+                   jit.unreachable_units,
+                   jit.unloaded_units,
+                   jit.unloaded_bytes);
+    }
+  }
+
   timer::timer(native_persistent_string_view const &region)
     : region{ region }
   {
@@ -11,6 +11,7 @@
 #include <jank/runtime/obj/symbol.hpp>
 #include <jank/runtime/obj/keyword.hpp>
 #include <jank/runtime/obj/persistent_string.hpp>
+#include <jank/runtime/string_intern.hpp>
 #include <jank/read/parse.hpp>
 #include <jank/util/escape.hpp>
 
@@ -366,17 +367,27 @@ namespace jank::read::parse
                                      start_token,
                                      latest_token };
         }
+        /* Like Clojure, `^vector` is short for `^{:tag vector}`. */
+        else if constexpr(std::same_as<T, runtime::obj::symbol>)
+        {
+          return object_source_info{ runtime::obj::persistent_array_map::create_unique(
+                                       rt_ctx.intern_keyword("", "tag", true).expect_ok(),
+                                       typed_val),
+                                     start_token,
+                                     latest_token };
+        }
         /* TODO: Concept for map-like. */
-        if constexpr(std::same_as<T, runtime::obj::persistent_hash_map>
-                     || std::same_as<T, runtime::obj::persistent_array_map>)
+        else if constexpr(std::same_as<T, runtime::obj::persistent_hash_map>
+                          || std::same_as<T, runtime::obj::persistent_array_map>)
         {
           return object_source_info{ typed_val, start_token, latest_token };
         }
         else
         {
-          return err(error{
-            start_token.pos,
-            native_persistent_string{ "value after meta hint ^ must be a keyword or map" } });
+          return err(
+            error{ start_token.pos,
+                   native_persistent_string{
+                     "value after meta hint ^ must be a keyword, symbol or map" } });
         }
       },
       meta_val_result.expect_ok().unwrap().ptr));
@@ -1176,8 +1187,7 @@ namespace jank::read::parse
     auto const token(token_current->expect_ok());
     ++token_current;
     auto const sv(boost::get<native_persistent_string_view>(token.data));
-    return object_source_info{ make_box<runtime::obj::persistent_string>(
-                                 native_persistent_string{ sv.data(), sv.size() }),
+    return object_source_info{ make_string(native_persistent_string{ sv.data(), sv.size() }),
                                token,
                                token };
   }
@@ -1192,9 +1202,17 @@ namespace jank::read::parse
     {
       return err(error{ token.pos, res.expect_err_move() });
     }
-    return object_source_info{ make_box<runtime::obj::persistent_string>(res.expect_ok_move()),
-                               token,
-                               token };
+    return object_source_info{ make_string(res.expect_ok_move()), token, token };
+  }
+
+  runtime::obj::persistent_string_ptr
+  processor::make_string(native_persistent_string const &s) const
+  {
+    if(rt_ctx.intern_strings)
+    {
+      return runtime::intern_string(s);
+    }
+    return make_box<runtime::obj::persistent_string>(s);
   }
 
   processor::iterator processor::begin()
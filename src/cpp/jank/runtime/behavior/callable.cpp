@@ -6,6 +6,7 @@
 #include <jank/runtime/obj/native_array_sequence.hpp>
 #include <jank/runtime/obj/native_vector_sequence.hpp>
 #include <jank/runtime/obj/persistent_list.hpp>
+#include <jank/runtime/obj/persistent_vector.hpp>
 #include <jank/runtime/seq.hpp>
 #include <jank/util/make_array.hpp>
 
@@ -13,6 +14,36 @@ namespace jank::runtime
 {
   using namespace behavior;
 
+  namespace detail
+  {
+    /* Rest args are gathered into an array seq which lives in the caller's frame for the
+     * duration of the call, rather than on the heap. A callee which holds onto them copies
+     * them over with `materialize_rest`. */
+    template <size_t N>
+    struct stack_rest
+    {
+      template <typename... Args>
+      stack_rest(Args const... args)
+        : arr{ args... }
+      {
+      }
+
+      stack_rest(stack_rest const &) = delete;
+      stack_rest(stack_rest &&) = delete;
+
+      object_ptr seq_ptr()
+      {
+        return &seq;
+      }
+
+      object_ptr arr[N];
+      obj::native_array_sequence seq{ arr, N };
+    };
+
+    template <typename... Args>
+    stack_rest(Args...) -> stack_rest<sizeof...(Args)>;
+  }
+
   object_ptr dynamic_call(object_ptr const source)
   {
     return visit_object(
@@ -54,7 +85,7 @@ namespace jank::runtime
           switch(mask)
           {
             case callable::mask_variadic_arity(0):
-              return typed_source->call(make_box<obj::native_array_sequence>(a1));
+              return typed_source->call(detail::stack_rest{ a1 }.seq_ptr());
             case callable::mask_variadic_arity(1):
               if(!callable::is_variadic_ambiguous(arity_flags))
               {
@@ -95,9 +126,9 @@ namespace jank::runtime
           switch(mask)
           {
             case callable::mask_variadic_arity(0):
-              return typed_source->call(make_box<obj::native_array_sequence>(a1, a2));
+              return typed_source->call(detail::stack_rest{ a1, a2 }.seq_ptr());
             case callable::mask_variadic_arity(1):
-              return typed_source->call(a1, make_box<obj::native_array_sequence>(a2));
+              return typed_source->call(a1, detail::stack_rest{ a2 }.seq_ptr());
             case callable::mask_variadic_arity(2):
               if(!callable::is_variadic_ambiguous(arity_flags))
               {
@@ -139,11 +170,11 @@ namespace jank::runtime
           switch(mask)
           {
             case callable::mask_variadic_arity(0):
-              return typed_source->call(make_box<obj::native_array_sequence>(a1, a2, a3));
+              return typed_source->call(detail::stack_rest{ a1, a2, a3 }.seq_ptr());
             case callable::mask_variadic_arity(1):
-              return typed_source->call(a1, make_box<obj::native_array_sequence>(a2, a3));
+              return typed_source->call(a1, detail::stack_rest{ a2, a3 }.seq_ptr());
             case callable::mask_variadic_arity(2):
-              return typed_source->call(a1, a2, make_box<obj::native_array_sequence>(a3));
+              return typed_source->call(a1, a2, detail::stack_rest{ a3 }.seq_ptr());
             case callable::mask_variadic_arity(3):
               if(!callable::is_variadic_ambiguous(arity_flags))
               {
@@ -180,13 +211,13 @@ namespace jank::runtime
           switch(mask)
           {
             case callable::mask_variadic_arity(0):
-              return typed_source->call(make_box<obj::native_array_sequence>(a1, a2, a3, a4));
+              return typed_source->call(detail::stack_rest{ a1, a2, a3, a4 }.seq_ptr());
             case callable::mask_variadic_arity(1):
-              return typed_source->call(a1, make_box<obj::native_array_sequence>(a2, a3, a4));
+              return typed_source->call(a1, detail::stack_rest{ a2, a3, a4 }.seq_ptr());
             case callable::mask_variadic_arity(2):
-              return typed_source->call(a1, a2, make_box<obj::native_array_sequence>(a3, a4));
+              return typed_source->call(a1, a2, detail::stack_rest{ a3, a4 }.seq_ptr());
             case callable::mask_variadic_arity(3):
-              return typed_source->call(a1, a2, a3, make_box<obj::native_array_sequence>(a4));
+              return typed_source->call(a1, a2, a3, detail::stack_rest{ a4 }.seq_ptr());
             case callable::mask_variadic_arity(4):
               if(!callable::is_variadic_ambiguous(arity_flags))
               {
@@ -224,15 +255,15 @@ namespace jank::runtime
           switch(mask)
           {
             case callable::mask_variadic_arity(0):
-              return typed_source->call(make_box<obj::native_array_sequence>(a1, a2, a3, a4, a5));
+              return typed_source->call(detail::stack_rest{ a1, a2, a3, a4, a5 }.seq_ptr());
             case callable::mask_variadic_arity(1):
-              return typed_source->call(a1, make_box<obj::native_array_sequence>(a2, a3, a4, a5));
+              return typed_source->call(a1, detail::stack_rest{ a2, a3, a4, a5 }.seq_ptr());
             case callable::mask_variadic_arity(2):
-              return typed_source->call(a1, a2, make_box<obj::native_array_sequence>(a3, a4, a5));
+              return typed_source->call(a1, a2, detail::stack_rest{ a3, a4, a5 }.seq_ptr());
             case callable::mask_variadic_arity(3):
-              return typed_source->call(a1, a2, a3, make_box<obj::native_array_sequence>(a4, a5));
+              return typed_source->call(a1, a2, a3, detail::stack_rest{ a4, a5 }.seq_ptr());
             case callable::mask_variadic_arity(4):
-              return typed_source->call(a1, a2, a3, a4, make_box<obj::native_array_sequence>(a5));
+              return typed_source->call(a1, a2, a3, a4, detail::stack_rest{ a5 }.seq_ptr());
             case callable::mask_variadic_arity(5):
               if(!callable::is_variadic_ambiguous(arity_flags))
               {
@@ -271,29 +302,18 @@ namespace jank::runtime
           switch(mask)
           {
             case callable::mask_variadic_arity(0):
-              return typed_source->call(
-                make_box<obj::native_array_sequence>(a1, a2, a3, a4, a5, a6));
+              return typed_source->call(detail::stack_rest{ a1, a2, a3, a4, a5, a6 }.seq_ptr());
             case callable::mask_variadic_arity(1):
-              return typed_source->call(a1,
-                                        make_box<obj::native_array_sequence>(a2, a3, a4, a5, a6));
+              return typed_source->call(a1, detail::stack_rest{ a2, a3, a4, a5, a6 }.seq_ptr());
             case callable::mask_variadic_arity(2):
-              return typed_source->call(a1,
-                                        a2,
-                                        make_box<obj::native_array_sequence>(a3, a4, a5, a6));
+              return typed_source->call(a1, a2, detail::stack_rest{ a3, a4, a5, a6 }.seq_ptr());
             case callable::mask_variadic_arity(3):
-              return typed_source->call(a1,
-                                        a2,
-                                        a3,
-                                        make_box<obj::native_array_sequence>(a4, a5, a6));
+              return typed_source->call(a1, a2, a3, detail::stack_rest{ a4, a5, a6 }.seq_ptr());
             case callable::mask_variadic_arity(4):
-              return typed_source->call(a1,
-                                        a2,
-                                        a3,
-                                        a4,
-                                        make_box<obj::native_array_sequence>(a5, a6));
+              return typed_source->call(a1, a2, a3, a4, detail::stack_rest{ a5, a6 }.seq_ptr());
             case callable::mask_variadic_arity(5):
               return typed_source
-                ->call(a1, a2, a3, a4, a5, make_box<obj::native_array_sequence>(a6));
+                ->call(a1, a2, a3, a4, a5, detail::stack_rest{ a6 }.seq_ptr());
             case callable::mask_variadic_arity(6):
               if(!callable::is_variadic_ambiguous(arity_flags))
               {
@@ -333,33 +353,21 @@ namespace jank::runtime
           switch(mask)
           {
             case callable::mask_variadic_arity(0):
-              return typed_source->call(
-                make_box<obj::native_array_sequence>(a1, a2, a3, a4, a5, a6, a7));
+              return typed_source->call(detail::stack_rest{ a1, a2, a3, a4, a5, a6, a7 }.seq_ptr());
             case callable::mask_variadic_arity(1):
-              return typed_source->call(
-                a1,
-                make_box<obj::native_array_sequence>(a2, a3, a4, a5, a6, a7));
+              return typed_source->call(a1, detail::stack_rest{ a2, a3, a4, a5, a6, a7 }.seq_ptr());
             case callable::mask_variadic_arity(2):
-              return typed_source->call(a1,
-                                        a2,
-                                        make_box<obj::native_array_sequence>(a3, a4, a5, a6, a7));
+              return typed_source->call(a1, a2, detail::stack_rest{ a3, a4, a5, a6, a7 }.seq_ptr());
             case callable::mask_variadic_arity(3):
-              return typed_source->call(a1,
-                                        a2,
-                                        a3,
-                                        make_box<obj::native_array_sequence>(a4, a5, a6, a7));
+              return typed_source->call(a1, a2, a3, detail::stack_rest{ a4, a5, a6, a7 }.seq_ptr());
             case callable::mask_variadic_arity(4):
-              return typed_source->call(a1,
-                                        a2,
-                                        a3,
-                                        a4,
-                                        make_box<obj::native_array_sequence>(a5, a6, a7));
+              return typed_source->call(a1, a2, a3, a4, detail::stack_rest{ a5, a6, a7 }.seq_ptr());
             case callable::mask_variadic_arity(5):
               return typed_source
-                ->call(a1, a2, a3, a4, a5, make_box<obj::native_array_sequence>(a6, a7));
+                ->call(a1, a2, a3, a4, a5, detail::stack_rest{ a6, a7 }.seq_ptr());
             case callable::mask_variadic_arity(6):
               return typed_source
-                ->call(a1, a2, a3, a4, a5, a6, make_box<obj::native_array_sequence>(a7));
+                ->call(a1, a2, a3, a4, a5, a6, detail::stack_rest{ a7 }.seq_ptr());
             case callable::mask_variadic_arity(7):
               if(!callable::is_variadic_ambiguous(arity_flags))
               {
@@ -401,36 +409,36 @@ namespace jank::runtime
           {
             case callable::mask_variadic_arity(0):
               return typed_source->call(
-                make_box<obj::native_array_sequence>(a1, a2, a3, a4, a5, a6, a7, a8));
+                detail::stack_rest{ a1, a2, a3, a4, a5, a6, a7, a8 }.seq_ptr());
             case callable::mask_variadic_arity(1):
               return typed_source->call(
                 a1,
-                make_box<obj::native_array_sequence>(a2, a3, a4, a5, a6, a7, a8));
+                detail::stack_rest{ a2, a3, a4, a5, a6, a7, a8 }.seq_ptr());
             case callable::mask_variadic_arity(2):
               return typed_source->call(
                 a1,
                 a2,
-                make_box<obj::native_array_sequence>(a3, a4, a5, a6, a7, a8));
+                detail::stack_rest{ a3, a4, a5, a6, a7, a8 }.seq_ptr());
             case callable::mask_variadic_arity(3):
               return typed_source->call(a1,
                                         a2,
                                         a3,
-                                        make_box<obj::native_array_sequence>(a4, a5, a6, a7, a8));
+                                        detail::stack_rest{ a4, a5, a6, a7, a8 }.seq_ptr());
             case callable::mask_variadic_arity(4):
               return typed_source->call(a1,
                                         a2,
                                         a3,
                                         a4,
-                                        make_box<obj::native_array_sequence>(a5, a6, a7, a8));
+                                        detail::stack_rest{ a5, a6, a7, a8 }.seq_ptr());
             case callable::mask_variadic_arity(5):
               return typed_source
-                ->call(a1, a2, a3, a4, a5, make_box<obj::native_array_sequence>(a6, a7, a8));
+                ->call(a1, a2, a3, a4, a5, detail::stack_rest{ a6, a7, a8 }.seq_ptr());
             case callable::mask_variadic_arity(6):
               return typed_source
-                ->call(a1, a2, a3, a4, a5, a6, make_box<obj::native_array_sequence>(a7, a8));
+                ->call(a1, a2, a3, a4, a5, a6, detail::stack_rest{ a7, a8 }.seq_ptr());
             case callable::mask_variadic_arity(7):
               return typed_source
-                ->call(a1, a2, a3, a4, a5, a6, a7, make_box<obj::native_array_sequence>(a8));
+                ->call(a1, a2, a3, a4, a5, a6, a7, detail::stack_rest{ a8 }.seq_ptr());
             case callable::mask_variadic_arity(8):
               if(!callable::is_variadic_ambiguous(arity_flags))
               {
@@ -473,37 +481,37 @@ namespace jank::runtime
           {
             case callable::mask_variadic_arity(0):
               return typed_source->call(
-                make_box<obj::native_array_sequence>(a1, a2, a3, a4, a5, a6, a7, a8, a9));
+                detail::stack_rest{ a1, a2, a3, a4, a5, a6, a7, a8, a9 }.seq_ptr());
             case callable::mask_variadic_arity(1):
               return typed_source->call(
                 a1,
-                make_box<obj::native_array_sequence>(a2, a3, a4, a5, a6, a7, a8, a9));
+                detail::stack_rest{ a2, a3, a4, a5, a6, a7, a8, a9 }.seq_ptr());
             case callable::mask_variadic_arity(2):
               return typed_source->call(
                 a1,
                 a2,
-                make_box<obj::native_array_sequence>(a3, a4, a5, a6, a7, a8, a9));
+                detail::stack_rest{ a3, a4, a5, a6, a7, a8, a9 }.seq_ptr());
             case callable::mask_variadic_arity(3):
               return typed_source
-                ->call(a1, a2, a3, make_box<obj::native_array_sequence>(a4, a5, a6, a7, a8, a9));
+                ->call(a1, a2, a3, detail::stack_rest{ a4, a5, a6, a7, a8, a9 }.seq_ptr());
             case callable::mask_variadic_arity(4):
               return typed_source->call(a1,
                                         a2,
                                         a3,
                                         a4,
-                                        make_box<obj::native_array_sequence>(a5, a6, a7, a8, a9));
+                                        detail::stack_rest{ a5, a6, a7, a8, a9 }.seq_ptr());
             case callable::mask_variadic_arity(5):
               return typed_source
-                ->call(a1, a2, a3, a4, a5, make_box<obj::native_array_sequence>(a6, a7, a8, a9));
+                ->call(a1, a2, a3, a4, a5, detail::stack_rest{ a6, a7, a8, a9 }.seq_ptr());
             case callable::mask_variadic_arity(6):
               return typed_source
-                ->call(a1, a2, a3, a4, a5, a6, make_box<obj::native_array_sequence>(a7, a8, a9));
+                ->call(a1, a2, a3, a4, a5, a6, detail::stack_rest{ a7, a8, a9 }.seq_ptr());
             case callable::mask_variadic_arity(7):
               return typed_source
-                ->call(a1, a2, a3, a4, a5, a6, a7, make_box<obj::native_array_sequence>(a8, a9));
+                ->call(a1, a2, a3, a4, a5, a6, a7, detail::stack_rest{ a8, a9 }.seq_ptr());
             case callable::mask_variadic_arity(8):
               return typed_source
-                ->call(a1, a2, a3, a4, a5, a6, a7, a8, make_box<obj::native_array_sequence>(a9));
+                ->call(a1, a2, a3, a4, a5, a6, a7, a8, detail::stack_rest{ a9 }.seq_ptr());
             case callable::mask_variadic_arity(9):
               if(!callable::is_variadic_ambiguous(arity_flags))
               {
@@ -548,36 +556,36 @@ namespace jank::runtime
           {
             case callable::mask_variadic_arity(0):
               return typed_source->call(
-                make_box<obj::native_array_sequence>(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10));
+                detail::stack_rest{ a1, a2, a3, a4, a5, a6, a7, a8, a9, a10 }.seq_ptr());
             case callable::mask_variadic_arity(1):
               return typed_source->call(
                 a1,
-                make_box<obj::native_array_sequence>(a2, a3, a4, a5, a6, a7, a8, a9, a10));
+                detail::stack_rest{ a2, a3, a4, a5, a6, a7, a8, a9, a10 }.seq_ptr());
             case callable::mask_variadic_arity(2):
               return typed_source->call(
                 a1,
                 a2,
-                make_box<obj::native_array_sequence>(a3, a4, a5, a6, a7, a8, a9, a10));
+                detail::stack_rest{ a3, a4, a5, a6, a7, a8, a9, a10 }.seq_ptr());
             case callable::mask_variadic_arity(3):
               return typed_source->call(
                 a1,
                 a2,
                 a3,
-                make_box<obj::native_array_sequence>(a4, a5, a6, a7, a8, a9, a10));
+                detail::stack_rest{ a4, a5, a6, a7, a8, a9, a10 }.seq_ptr());
             case callable::mask_variadic_arity(4):
               return typed_source->call(
                 a1,
                 a2,
                 a3,
                 a4,
-                make_box<obj::native_array_sequence>(a5, a6, a7, a8, a9, a10));
+                detail::stack_rest{ a5, a6, a7, a8, a9, a10 }.seq_ptr());
             case callable::mask_variadic_arity(5):
               return typed_source->call(a1,
                                         a2,
                                         a3,
                                         a4,
                                         a5,
-                                        make_box<obj::native_array_sequence>(a6, a7, a8, a9, a10));
+                                        detail::stack_rest{ a6, a7, a8, a9, a10 }.seq_ptr());
             case callable::mask_variadic_arity(6):
               return typed_source->call(a1,
                                         a2,
@@ -585,7 +593,7 @@ namespace jank::runtime
                                         a4,
                                         a5,
                                         a6,
-                                        make_box<obj::native_array_sequence>(a7, a8, a9, a10));
+                                        detail::stack_rest{ a7, a8, a9, a10 }.seq_ptr());
             case callable::mask_variadic_arity(7):
               return typed_source->call(a1,
                                         a2,
@@ -594,7 +602,7 @@ namespace jank::runtime
                                         a5,
                                         a6,
                                         a7,
-                                        make_box<obj::native_array_sequence>(a8, a9, a10));
+                                        detail::stack_rest{ a8, a9, a10 }.seq_ptr());
             case callable::mask_variadic_arity(8):
               return typed_source->call(a1,
                                         a2,
@@ -604,7 +612,7 @@ namespace jank::runtime
                                         a6,
                                         a7,
                                         a8,
-                                        make_box<obj::native_array_sequence>(a9, a10));
+                                        detail::stack_rest{ a9, a10 }.seq_ptr());
             case callable::mask_variadic_arity(9):
               return typed_source->call(a1,
                                         a2,
@@ -615,7 +623,7 @@ namespace jank::runtime
                                         a7,
                                         a8,
                                         a9,
-                                        make_box<obj::native_array_sequence>(a10));
+                                        detail::stack_rest{ a10 }.seq_ptr());
             case callable::mask_variadic_arity(10):
               if(!callable::is_variadic_ambiguous(arity_flags))
               {
@@ -628,7 +636,7 @@ namespace jank::runtime
                                           a7,
                                           a8,
                                           a9,
-                                          make_box<obj::native_array_sequence>(a10));
+                                          detail::stack_rest{ a10 }.seq_ptr());
               }
             default:
               return typed_source->call(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10);
@@ -806,113 +814,175 @@ namespace jank::runtime
       source);
   }
 
-  object_ptr apply_to(object_ptr const source, object_ptr const args)
+  namespace detail
   {
-    return visit_object(
-      [=](auto const typed_args) -> object_ptr {
-        using T = typename decltype(typed_args)::value_type;
+    /* Applying a fn used to mean building a seq of all of the args, just to walk it again
+     * while unpacking it. Instead, we gather the args onto the stack. Only the args beyond
+     * max_params, which can't be passed individually, end up in a list. */
+    struct apply_args
+    {
+      void push(object_ptr const o)
+      {
+        fixed[count++] = o;
+      }
+
+      void spread(object_ptr const args)
+      {
+        visit_object(
+          [this](auto const typed_args) {
+            using T = typename decltype(typed_args)::value_type;
 
-        if constexpr(seqable<T>)
+            /* Vectors are spread straight from their storage, without a seq. */
+            if constexpr(std::same_as<T, obj::persistent_vector>)
+            {
+              auto it(typed_args->data.begin());
+              auto const end(typed_args->data.end());
+              for(; it != end && count < max_params; ++it)
+              {
+                push(*it);
+              }
+              if(it != end)
+              {
+                native_vector<object_ptr> const more(it, end);
+                rest = make_box<obj::persistent_list>(
+                  runtime::detail::native_persistent_list{ more.rbegin(), more.rend() });
+              }
+            }
+            else if constexpr(seqable<T>)
+            {
+              auto it(typed_args->fresh_seq());
+              for(; it != nullptr && count < max_params; it = it->next_in_place())
+              {
+                push(it->first());
+              }
+              if(it != nullptr)
+              {
+                rest = obj::persistent_list::create(it);
+              }
+            }
+            else
+            {
+              throw std::runtime_error{ fmt::format("not seqable: {}", typed_args->to_string()) };
+            }
+          },
+          args);
+      }
+
+      object_ptr call(object_ptr const source) const
+      {
+        auto const &a(fixed);
+        if(rest)
         {
-          auto const s(typed_args->fresh_seq());
-          auto const length(runtime::detail::sequence_length(s, max_params + 1));
-          switch(length)
-          {
-            case 0:
-              return dynamic_call(source);
-            case 1:
-              return dynamic_call(source, s->first());
-            case 2:
-              return dynamic_call(source, s->first(), s->next_in_place_first());
-            case 3:
-              return dynamic_call(source,
-                                  s->first(),
-                                  s->next_in_place_first(),
-                                  s->next_in_place_first());
-            case 4:
-              return dynamic_call(source,
-                                  s->first(),
-                                  s->next_in_place_first(),
-                                  s->next_in_place_first(),
-                                  s->next_in_place_first());
-            case 5:
-              return dynamic_call(source,
-                                  s->first(),
-                                  s->next_in_place_first(),
-                                  s->next_in_place_first(),
-                                  s->next_in_place_first(),
-                                  s->next_in_place_first());
-            case 6:
-              return dynamic_call(source,
-                                  s->first(),
-                                  s->next_in_place_first(),
-                                  s->next_in_place_first(),
-                                  s->next_in_place_first(),
-                                  s->next_in_place_first(),
-                                  s->next_in_place_first());
-            case 7:
-              return dynamic_call(source,
-                                  s->first(),
-                                  s->next_in_place_first(),
-                                  s->next_in_place_first(),
-                                  s->next_in_place_first(),
-                                  s->next_in_place_first(),
-                                  s->next_in_place_first(),
-                                  s->next_in_place_first());
-            case 8:
-              return dynamic_call(source,
-                                  s->first(),
-                                  s->next_in_place_first(),
-                                  s->next_in_place_first(),
-                                  s->next_in_place_first(),
-                                  s->next_in_place_first(),
-                                  s->next_in_place_first(),
-                                  s->next_in_place_first(),
-                                  s->next_in_place_first());
-            case 9:
-              return dynamic_call(source,
-                                  s->first(),
-                                  s->next_in_place_first(),
-                                  s->next_in_place_first(),
-                                  s->next_in_place_first(),
-                                  s->next_in_place_first(),
-                                  s->next_in_place_first(),
-                                  s->next_in_place_first(),
-                                  s->next_in_place_first(),
-                                  s->next_in_place_first());
-            case 10:
-              return dynamic_call(source,
-                                  s->first(),
-                                  s->next_in_place_first(),
-                                  s->next_in_place_first(),
-                                  s->next_in_place_first(),
-                                  s->next_in_place_first(),
-                                  s->next_in_place_first(),
-                                  s->next_in_place_first(),
-                                  s->next_in_place_first(),
-                                  s->next_in_place_first(),
-                                  s->next_in_place_first());
-            default:
-              return dynamic_call(source,
-                                  s->first(),
-                                  s->next_in_place_first(),
-                                  s->next_in_place_first(),
-                                  s->next_in_place_first(),
-                                  s->next_in_place_first(),
-                                  s->next_in_place_first(),
-                                  s->next_in_place_first(),
-                                  s->next_in_place_first(),
-                                  s->next_in_place_first(),
-                                  s->next_in_place_first(),
-                                  obj::persistent_list::create(s->next_in_place()));
-          }
+          return dynamic_call(source,
+                              a[0],
+                              a[1],
+                              a[2],
+                              a[3],
+                              a[4],
+                              a[5],
+                              a[6],
+                              a[7],
+                              a[8],
+                              a[9],
+                              rest);
         }
-        else
+
+        switch(count)
         {
-          throw std::runtime_error{ fmt::format("not seqable: {}", typed_args->to_string()) };
+          case 0:
+            return dynamic_call(source);
+          case 1:
+            return dynamic_call(source, a[0]);
+          case 2:
+            return dynamic_call(source, a[0], a[1]);
+          case 3:
+            return dynamic_call(source, a[0], a[1], a[2]);
+          case 4:
+            return dynamic_call(source, a[0], a[1], a[2], a[3]);
+          case 5:
+            return dynamic_call(source, a[0], a[1], a[2], a[3], a[4]);
+          case 6:
+            return dynamic_call(source, a[0], a[1], a[2], a[3], a[4], a[5]);
+          case 7:
+            return dynamic_call(source, a[0], a[1], a[2], a[3], a[4], a[5], a[6]);
+          case 8:
+            return dynamic_call(source, a[0], a[1], a[2], a[3], a[4], a[5], a[6], a[7]);
+          case 9:
+            return dynamic_call(source, a[0], a[1], a[2], a[3], a[4], a[5], a[6], a[7], a[8]);
+          default:
+            return dynamic_call(source,
+                                a[0],
+                                a[1],
+                                a[2],
+                                a[3],
+                                a[4],
+                                a[5],
+                                a[6],
+                                a[7],
+                                a[8],
+                                a[9]);
         }
-      },
-      args);
+      }
+
+      std::array<object_ptr, max_params> fixed;
+      size_t count{};
+      obj::persistent_list_ptr rest{};
+    };
+  }
+
+  object_ptr apply_to(object_ptr const source, object_ptr const args)
+  {
+    detail::apply_args packed;
+    packed.spread(args);
+    return packed.call(source);
+  }
+
+  object_ptr apply_to(object_ptr const source, object_ptr const a1, object_ptr const args)
+  {
+    detail::apply_args packed;
+    packed.push(a1);
+    packed.spread(args);
+    return packed.call(source);
+  }
+
+  object_ptr
+  apply_to(object_ptr const source, object_ptr const a1, object_ptr const a2, object_ptr const args)
+  {
+    detail::apply_args packed;
+    packed.push(a1);
+    packed.push(a2);
+    packed.spread(args);
+    return packed.call(source);
+  }
+
+  object_ptr apply_to(object_ptr const source,
+                      object_ptr const a1,
+                      object_ptr const a2,
+                      object_ptr const a3,
+                      object_ptr const args)
+  {
+    detail::apply_args packed;
+    packed.push(a1);
+    packed.push(a2);
+    packed.push(a3);
+    packed.spread(args);
+    return packed.call(source);
+  }
+
+  object_ptr materialize_rest(object_ptr const rest)
+  {
+    /* Rest args which came from apply, or which didn't fit into max_params, are already
+     * on the heap. */
+    if(rest->type != object_type::native_array_sequence || GC_is_heap_ptr(rest.data))
+    {
+      return rest;
+    }
+
+    auto const typed_rest(expect_object<obj::native_array_sequence>(rest));
+    auto const size(typed_rest->size - typed_rest->index);
+    auto const arr(make_array_box<object_ptr>(size));
+    std::copy_n(typed_rest->arr + typed_rest->index, size, arr.data);
+    return make_box<obj::native_array_sequence>(arr.data, size);
   }
 
   namespace behavior
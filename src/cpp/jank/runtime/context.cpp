@@ -1,3 +1,4 @@
+#include <cmath>
 #include <exception>
 
 #include <fmt/compile.h>
@@ -5,15 +6,18 @@
 #include <jank/read/lex.hpp>
 #include <jank/read/parse.hpp>
 #include <jank/runtime/context.hpp>
+#include <jank/runtime/gc.hpp>
 #include <jank/runtime/obj/native_function_wrapper.hpp>
 #include <jank/runtime/obj/persistent_string.hpp>
 #include <jank/runtime/obj/number.hpp>
 #include <jank/runtime/util.hpp>
 #include <jank/runtime/seq.hpp>
+#include <jank/runtime/string_intern.hpp>
 #include <jank/analyze/processor.hpp>
 #include <jank/codegen/processor.hpp>
 #include <jank/evaluate.hpp>
 #include <jank/jit/processor.hpp>
+#include <jank/util/arena.hpp>
 #include <jank/util/mapped_file.hpp>
 #include <jank/util/process_location.hpp>
 
@@ -31,6 +35,8 @@ namespace jank::runtime
     : jit_prc{ *this, opts.optimization_level }
     , output_dir{ opts.compilation_path }
     , module_loader{ *this, opts.class_path }
+    , direct_linking{ opts.direct_linking }
+    , intern_strings{ opts.intern_strings }
   {
     auto const core(intern_ns(make_box<obj::symbol>("clojure.core")));
     auto const ns_sym(make_box<obj::symbol>("clojure.core/*ns*"));
@@ -63,14 +69,11 @@ namespace jank::runtime
     in_ns_var = intern_var(in_ns_sym).expect_ok();
 
     /* TODO: Remove this once it can be defined in jank. */
-    auto const seq_sym(make_box<obj::symbol>("clojure.core/seq"));
-    intern_var(seq_sym).expect_ok()->bind_root(
-      make_box<obj::native_function_wrapper>(static_cast<object_ptr (*)(object_ptr)>(&seq)));
-
-    auto const fresh_seq_sym(make_box<obj::symbol>("clojure.core/fresh-seq"));
-    intern_var(fresh_seq_sym)
-      .expect_ok()
-      ->bind_root(make_box<obj::native_function_wrapper>(&fresh_seq));
+    intern_native_fns("clojure.core",
+                      { { "seq", static_cast<object_ptr (*)(object_ptr)>(&seq) },
+                        { "fresh-seq", &fresh_seq },
+                        { "intern-str", &intern_str } });
+    intern_gc_fns(*this);
 
     push_thread_bindings(obj::persistent_hash_map::create_unique(
                            std::make_pair(current_ns_var, current_ns_var->deref())))
@@ -82,6 +85,8 @@ namespace jank::runtime
     , module_dependencies{ ctx.module_dependencies }
     , output_dir{ ctx.output_dir }
     , module_loader{ *this, ctx.module_loader.paths }
+    , direct_linking{ ctx.direct_linking }
+    , intern_strings{ ctx.intern_strings }
   {
     {
       auto ns_lock(namespaces.wlock());
@@ -125,6 +130,9 @@ namespace jank::runtime
       = make_box<runtime::var>(core, make_box<obj::symbol>("*no-recur*"))->set_dynamic(true);
     gensym_env_var
       = make_box<runtime::var>(core, make_box<obj::symbol>("*gensym-env*"))->set_dynamic(true);
+
+    /* The cloned stats fn would still refer to the other context. */
+    intern_gc_fns(*this);
   }
 
   context::~context()
@@ -194,20 +202,31 @@ namespace jank::runtime
   object_ptr context::eval_string(native_persistent_string_view const &code)
   {
     profile::timer timer{ "rt eval_string" };
+    jit::entry const running;
     read::lex::processor l_prc{ code };
     read::parse::processor p_prc{ *this, l_prc.begin(), l_prc.end() };
 
+    /* Each form's expressions are dead once it has been evaluated, so they come from an arena
+     * which we release right after. When compiling, though, we need all of them at the end. */
+    native_bool const compiling{ detail::truthy(compile_files_var->deref()) };
+    util::arena module_arena;
+
     object_ptr ret{ obj::nil::nil_const() };
     native_vector<analyze::expression_ptr> exprs{};
     for(auto const &form : p_prc)
     {
+      util::arena form_arena;
+      util::arena::scope const arena_scope{ compiling ? module_arena : form_arena };
       auto const expr(
         an_prc.analyze(form.expect_ok().unwrap().ptr, analyze::expression_type::statement));
       ret = evaluate::eval(*this, jit_prc, expr.expect_ok());
-      exprs.emplace_back(expr.expect_ok());
+      if(compiling)
+      {
+        exprs.emplace_back(expr.expect_ok());
+      }
     }
 
-    if(detail::truthy(compile_files_var->deref()))
+    if(compiling)
     {
       auto const &current_module(
         expect_object<obj::persistent_string>(current_module_var->deref())->data);
@@ -229,9 +248,13 @@ namespace jank::runtime
   context::analyze_string(native_persistent_string_view const &code, native_bool const eval)
   {
     profile::timer timer{ "rt analyze_string" };
+    jit::entry const running;
     read::lex::processor l_prc{ code };
     read::parse::processor p_prc{ *this, l_prc.begin(), l_prc.end() };
 
+    /* Whatever arena our caller is in could be released before they're done with these. */
+    util::arena::scope const arena_scope{ analysis_arena };
+
     native_vector<analyze::expression_ptr> ret{};
     for(auto const &form : p_prc)
     {
@@ -445,6 +468,18 @@ namespace jank::runtime
     return ok(found_ns->second->intern_var(qualified_sym));
   }
 
+  ns_ptr context::intern_native_fns(native_persistent_string const &ns,
+                                    std::initializer_list<native_fn> const fns)
+  {
+    auto const n(intern_ns(make_box<obj::symbol>(ns)));
+    for(auto const &f : fns)
+    {
+      n->intern_var(make_box<obj::symbol>("", f.name))
+        ->bind_root(make_box<obj::native_function_wrapper>(f.fn));
+    }
+    return n;
+  }
+
   result<obj::keyword_ptr, native_persistent_string>
   context::intern_keyword(native_persistent_string_view const &ns,
                           native_persistent_string_view const &name,
@@ -489,6 +524,116 @@ namespace jank::runtime
     return res.first->second;
   }
 
+  /* This is stricter than `=`. For example, [1] and '(1) are equal, but a fn using one
+   * can't be given the other. Collections are compared in order, so the same map, built
+   * in a different order, isn't shared. That only costs us the sharing, though. */
+  static native_bool identical_constants(object_ptr const lhs, object_ptr const rhs)
+  {
+    if(lhs == rhs)
+    {
+      return true;
+    }
+    if(lhs->type != rhs->type)
+    {
+      return false;
+    }
+
+    return visit_object(
+      [&](auto const typed_lhs) -> native_bool {
+        using T = typename decltype(typed_lhs)::value_type;
+        auto const typed_rhs(expect_object<T>(rhs));
+
+        if constexpr(behavior::metadatable<T>)
+        {
+          if(typed_lhs->meta.is_some() != typed_rhs->meta.is_some())
+          {
+            return false;
+          }
+          if(typed_lhs->meta.is_some()
+             && !identical_constants(typed_lhs->meta.unwrap(), typed_rhs->meta.unwrap()))
+          {
+            return false;
+          }
+        }
+
+        if constexpr(std::same_as<T, obj::persistent_array_map>
+                     || std::same_as<T, obj::persistent_hash_map>)
+        {
+          if(typed_lhs->data.size() != typed_rhs->data.size())
+          {
+            return false;
+          }
+          auto r(typed_rhs->data.begin());
+          for(auto const &l : typed_lhs->data)
+          {
+            auto const &entry(*r);
+            if(!identical_constants(l.first, entry.first)
+               || !identical_constants(l.second, entry.second))
+            {
+              return false;
+            }
+            ++r;
+          }
+          return true;
+        }
+        else if constexpr(std::same_as<T, obj::persistent_vector>
+                          || std::same_as<T, obj::persistent_list>
+                          || std::same_as<T, obj::persistent_set>)
+        {
+          if(typed_lhs->data.size() != typed_rhs->data.size())
+          {
+            return false;
+          }
+          auto r(typed_rhs->data.begin());
+          for(auto const &l : typed_lhs->data)
+          {
+            if(!identical_constants(l, *r))
+            {
+              return false;
+            }
+            ++r;
+          }
+          return true;
+        }
+        /* Reals compare with `==`, so 0.0 and -0.0 are equal, but they behave differently.
+         * NaNs aren't equal to anything, so they're just not shared. */
+        else if constexpr(std::same_as<T, obj::real>)
+        {
+          return typed_lhs->data == typed_rhs->data
+            && std::signbit(typed_lhs->data) == std::signbit(typed_rhs->data);
+        }
+        else if constexpr(std::same_as<T, obj::integer> || std::same_as<T, obj::boolean>
+                          || std::same_as<T, obj::nil> || std::same_as<T, obj::persistent_string>
+                          || std::same_as<T, obj::symbol> || std::same_as<T, obj::keyword>)
+        {
+          return typed_lhs->equal(*rhs);
+        }
+        else
+        {
+          return false;
+        }
+      },
+      lhs);
+  }
+
+  object_ptr context::intern_constant(object_ptr const o)
+  {
+    profile::timer timer{ "rt intern_constant" };
+
+    auto const key(hash::visit(o));
+    auto locked_constants(constants.wlock());
+    for(auto * const c : locked_constants->find(key))
+    {
+      if(identical_constants(c, o))
+      {
+        return c;
+      }
+    }
+
+    locked_constants->insert(key, o);
+    return o;
+  }
+
   object_ptr context::macroexpand1(object_ptr const o)
   {
     profile::timer timer{ "rt macroexpand1" };
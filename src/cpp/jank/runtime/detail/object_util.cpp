@@ -40,6 +40,11 @@ namespace jank::runtime::detail
     {
       return !lhs;
     }
+    /* Constants are shared, so this is a common case. NaN is never equal to itself, though. */
+    else if(lhs == rhs && lhs->type != object_type::real)
+    {
+      return true;
+    }
 
     return visit_object([&](auto const typed_lhs) { return typed_lhs->equal(*rhs); }, lhs);
   }
@@ -71,6 +76,10 @@ namespace std
     {
       return !lhs;
     }
+    else if(lhs == rhs && lhs->type != jank::runtime::object_type::real)
+    {
+      return true;
+    }
 
     return jank::runtime::visit_object([&](auto const typed_lhs) { return typed_lhs->equal(*rhs); },
                                        lhs);
@@ -0,0 +1,177 @@
+#include <algorithm>
+#include <array>
+#include <chrono>
+
+#include <fmt/core.h>
+
+#include <jank/runtime/gc.hpp>
+#include <jank/runtime/context.hpp>
+#include <jank/runtime/obj/nil.hpp>
+#include <jank/runtime/obj/number.hpp>
+#include <jank/runtime/obj/persistent_hash_map.hpp>
+
+namespace jank::runtime
+{
+  /* The last few pause times, as a ring buffer. This is written by the GC's collection event
+   * callback, which runs with the allocation lock held, so it's read with that lock too. */
+  struct pause_log
+  {
+    std::array<native_integer, gc_stats::pause_window> pauses{};
+    size_t count{};
+    native_integer started{};
+  };
+
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+  static pause_log pauses;
+
+  static native_integer now()
+  {
+    using namespace std::chrono;
+    return duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+  }
+
+  /* This runs within the collector, so it mustn't allocate. */
+  static void on_collection_event(GC_EventType const event)
+  {
+    switch(event)
+    {
+      case GC_EVENT_START:
+        pauses.started = now();
+        break;
+      case GC_EVENT_END:
+        pauses.pauses[pauses.count % gc_stats::pause_window] = now() - pauses.started;
+        ++pauses.count;
+        break;
+      default:
+        break;
+    }
+  }
+
+  object_ptr gc_stats::to_object(context &rt_ctx) const
+  {
+    auto const kw([&](native_persistent_string_view const &name) -> object_ptr {
+      return rt_ctx.intern_keyword("", name, true).expect_ok();
+    });
+    auto const num([](auto const n) -> object_ptr {
+      return make_box(static_cast<native_integer>(n));
+    });
+
+    return obj::persistent_hash_map::create_unique(
+      std::make_pair(kw("heap-size"), num(heap_size)),
+      std::make_pair(kw("free-bytes"), num(free_bytes)),
+      std::make_pair(kw("unmapped-bytes"), num(unmapped_bytes)),
+      std::make_pair(kw("bytes-since-gc"), num(bytes_since_gc)),
+      std::make_pair(kw("total-bytes"), num(total_bytes)),
+      std::make_pair(kw("collections"), num(collections)),
+      std::make_pair(kw("free-space-divisor"), num(free_space_divisor)),
+      std::make_pair(kw("free-ratio"), make_box(free_ratio)),
+      std::make_pair(kw("last-pause-ns"), num(last_pause)),
+      std::make_pair(kw("p50-pause-ns"), num(p50_pause)),
+      std::make_pair(kw("p90-pause-ns"), num(p90_pause)),
+      std::make_pair(kw("p99-pause-ns"), num(p99_pause)),
+      std::make_pair(kw("max-pause-ns"), num(max_pause)));
+  }
+
+  gc_stats current_gc_stats()
+  {
+    gc_stats ret;
+
+    GC_word heap_size{}, free_bytes{}, unmapped_bytes{}, bytes_since_gc{}, total_bytes{};
+    GC_get_heap_usage_safe(&heap_size, &free_bytes, &unmapped_bytes, &bytes_since_gc, &total_bytes);
+    ret.heap_size = heap_size;
+    ret.free_bytes = free_bytes;
+    ret.unmapped_bytes = unmapped_bytes;
+    ret.bytes_since_gc = bytes_since_gc;
+    ret.total_bytes = total_bytes;
+    ret.collections = GC_get_gc_no();
+    ret.free_space_divisor = GC_get_free_space_divisor();
+    if(heap_size > 0)
+    {
+      ret.free_ratio = static_cast<native_real>(free_bytes) / static_cast<native_real>(heap_size);
+    }
+
+    pause_log log;
+    GC_call_with_alloc_lock(
+      [](void * const data) -> void * {
+        *static_cast<pause_log *>(data) = pauses;
+        return nullptr;
+      },
+      &log);
+
+    auto const size(std::min(log.count, gc_stats::pause_window));
+    if(size == 0)
+    {
+      return ret;
+    }
+
+    ret.last_pause = log.pauses[(log.count - 1) % gc_stats::pause_window];
+    auto const end(log.pauses.begin() + static_cast<std::ptrdiff_t>(size));
+    std::sort(log.pauses.begin(), end);
+    auto const percentile([&](size_t const p) { return log.pauses[(size - 1) * p / 100]; });
+    ret.p50_pause = percentile(50);
+    ret.p90_pause = percentile(90);
+    ret.p99_pause = percentile(99);
+    ret.max_pause = log.pauses[size - 1];
+
+    return ret;
+  }
+
+  void configure_gc(util::cli::options const &opts)
+  {
+    if(opts.gc_markers > 0)
+    {
+      if(GC_is_init_called())
+      {
+        fmt::println(stderr, "The GC is already initialized, so --gc-markers has no effect.");
+      }
+      else
+      {
+        GC_set_markers_count(static_cast<unsigned>(opts.gc_markers));
+      }
+    }
+
+    GC_INIT();
+    GC_set_on_collection_event(&on_collection_event);
+
+    if(opts.gc_free_space_divisor > 0)
+    {
+      GC_set_free_space_divisor(static_cast<GC_word>(opts.gc_free_space_divisor));
+    }
+    if(opts.gc_max_heap > 0)
+    {
+      GC_set_max_heap_size(opts.gc_max_heap);
+    }
+    if(opts.gc_initial_heap > GC_get_heap_size()
+       && !GC_expand_hp(opts.gc_initial_heap - GC_get_heap_size()))
+    {
+      fmt::println(stderr, "Unable to grow the GC heap to {} bytes.", opts.gc_initial_heap);
+    }
+    if(opts.gc_incremental)
+    {
+      GC_enable_incremental();
+    }
+  }
+
+  static object_ptr collect()
+  {
+    GC_gcollect();
+    return obj::nil::nil_const();
+  }
+
+  void intern_gc_fns(context &rt_ctx)
+  {
+    auto const gc_ns(rt_ctx.intern_native_fns("jank.gc", { { "collect", &collect } }));
+    gc_ns->intern_var(make_box<obj::symbol>("", "stats"))
+      ->bind_root(make_box<gc_stats_fn>(rt_ctx));
+  }
+
+  gc_stats_fn::gc_stats_fn(context &rt_ctx)
+    : rt_ctx{ rt_ctx }
+  {
+  }
+
+  object_ptr gc_stats_fn::call() const
+  {
+    return current_gc_stats().to_object(rt_ctx);
+  }
+}
@@ -961,6 +961,26 @@ namespace jank::runtime
       l);
   }
 
+  native_integer inc(obj::integer_ptr const l)
+  {
+    return l->data + 1;
+  }
+
+  native_real inc(obj::real_ptr const l)
+  {
+    return l->data + 1;
+  }
+
+  native_integer inc(native_integer const l)
+  {
+    return l + 1;
+  }
+
+  native_real inc(native_real const l)
+  {
+    return l + 1;
+  }
+
   object_ptr dec(object_ptr const l)
   {
     return visit_object(
@@ -979,6 +999,26 @@ namespace jank::runtime
       l);
   }
 
+  native_integer dec(obj::integer_ptr const l)
+  {
+    return l->data - 1;
+  }
+
+  native_real dec(obj::real_ptr const l)
+  {
+    return l->data - 1;
+  }
+
+  native_integer dec(native_integer const l)
+  {
+    return l - 1;
+  }
+
+  native_real dec(native_real const l)
+  {
+    return l - 1;
+  }
+
   native_bool is_zero(object_ptr const l)
   {
     return visit_object(
@@ -1000,6 +1040,19 @@ namespace jank::runtime
       l);
   }
 
+  native_bool is_zero(native_integer const l)
+  {
+    return l == 0;
+  }
+
+  native_bool is_zero(native_real const l)
+  {
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wfloat-equal"
+    return l == 0;
+#pragma clang diagnostic pop
+  }
+
   native_bool is_pos(object_ptr const l)
   {
     return visit_object(
@@ -1021,6 +1074,16 @@ namespace jank::runtime
       l);
   }
 
+  native_bool is_pos(native_integer const l)
+  {
+    return l > 0;
+  }
+
+  native_bool is_pos(native_real const l)
+  {
+    return l > 0;
+  }
+
   native_bool is_neg(object_ptr const l)
   {
     return visit_object(
@@ -1042,6 +1105,16 @@ namespace jank::runtime
       l);
   }
 
+  native_bool is_neg(native_integer const l)
+  {
+    return l < 0;
+  }
+
+  native_bool is_neg(native_real const l)
+  {
+    return l < 0;
+  }
+
   native_real rand()
   {
     static std::mt19937 gen;
@@ -2318,4 +2391,52 @@ namespace jank::runtime
   {
     return static_cast<native_integer>(l);
   }
+
+  native_integer unbox_integer(object_ptr const o)
+  {
+    if(o->type != object_type::integer)
+    {
+      throw std::runtime_error{ fmt::format("expected integer for unboxed local, found: {}",
+                                            detail::to_string(o)) };
+    }
+    return expect_object<obj::integer>(o)->data;
+  }
+
+  native_integer unbox_integer(native_integer const o)
+  {
+    return o;
+  }
+
+  native_integer unbox_integer(native_real const o)
+  {
+    throw std::runtime_error{ fmt::format("expected integer for unboxed local, found: {}", o) };
+  }
+
+  native_real unbox_real(object_ptr const o)
+  {
+    return visit_object(
+      [](auto const typed_o) -> native_real {
+        using T = typename decltype(typed_o)::value_type;
+
+        if constexpr(behavior::numberable<T>)
+        {
+          return typed_o->to_real();
+        }
+        else
+        {
+          throw std::runtime_error{ fmt::format("not a number: {}", typed_o->to_string()) };
+        }
+      },
+      o);
+  }
+
+  native_real unbox_real(native_integer const o)
+  {
+    return static_cast<native_real>(o);
+  }
+
+  native_real unbox_real(native_real const o)
+  {
+    return o;
+  }
 }
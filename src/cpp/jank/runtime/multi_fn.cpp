@@ -0,0 +1,268 @@
+#include <fmt/core.h>
+
+#include <jank/runtime/multi_fn.hpp>
+#include <jank/runtime/obj/persistent_set.hpp>
+#include <jank/runtime/detail/object_util.hpp>
+#include <jank/runtime/seq.hpp>
+
+namespace jank::runtime
+{
+  multi_fn::multi_fn(native_persistent_string const &name,
+                     object_ptr const dispatch_fn,
+                     object_ptr const default_value,
+                     var_ptr const hierarchy,
+                     object_ptr const resolve_fn)
+    : name{ name }
+    , dispatch_fn{ dispatch_fn }
+    , default_value{ default_value }
+    , hierarchy{ hierarchy }
+    , resolve_fn{ resolve_fn }
+  {
+    reset_cache(hierarchy->deref());
+  }
+
+  void multi_fn::reset_cache(object_ptr const hierarchy_value) const
+  {
+    method_cache.store(obj::persistent_hash_map::empty().data, std::memory_order_release);
+    cached_hierarchy.store(hierarchy_value.data, std::memory_order_release);
+  }
+
+  void multi_fn::add_method(object_ptr const dispatch_value, object_ptr const method)
+  {
+    std::lock_guard<std::mutex> const lock{ mutex };
+    method_table = method_table->assoc(dispatch_value, method);
+    reset_cache(hierarchy->deref());
+  }
+
+  void multi_fn::remove_method(object_ptr const dispatch_value)
+  {
+    std::lock_guard<std::mutex> const lock{ mutex };
+    method_table = make_box<obj::persistent_hash_map>(method_table->data.erase(dispatch_value));
+    reset_cache(hierarchy->deref());
+  }
+
+  void multi_fn::prefer_method(object_ptr const preferred, object_ptr const other)
+  {
+    std::lock_guard<std::mutex> const lock{ mutex };
+    auto const empty_set(obj::persistent_set::empty());
+    if(runtime::contains(prefer_table->get(other, empty_set), preferred))
+    {
+      throw std::runtime_error{ fmt::format(
+        "preference conflict in multimethod {}: {} is already preferred to {}",
+        name,
+        detail::to_string(other),
+        detail::to_string(preferred)) };
+    }
+
+    prefer_table = prefer_table->assoc(preferred,
+                                       conj(prefer_table->get(preferred, empty_set), other));
+    reset_cache(hierarchy->deref());
+  }
+
+  object_ptr multi_fn::find_method(object_ptr const dispatch_value) const
+  {
+    auto const hierarchy_value(hierarchy->deref());
+    if(cached_hierarchy.load(std::memory_order_acquire) == hierarchy_value.data)
+    {
+      auto const * const found(
+        method_cache.load(std::memory_order_acquire)->data.find(dispatch_value));
+      if(found)
+      {
+        return *found;
+      }
+    }
+
+    std::lock_guard<std::mutex> const lock{ mutex };
+    if(cached_hierarchy.load(std::memory_order_relaxed) != hierarchy_value.data)
+    {
+      reset_cache(hierarchy_value);
+    }
+
+    auto const method(dynamic_call(resolve_fn,
+                                   method_table,
+                                   prefer_table,
+                                   hierarchy_value,
+                                   dispatch_value,
+                                   default_value));
+    if(method == obj::nil::nil_const())
+    {
+      throw std::runtime_error{ fmt::format("no method in multimethod {} for dispatch value: {}",
+                                            name,
+                                            detail::to_string(dispatch_value)) };
+    }
+
+    auto const cache(method_cache.load(std::memory_order_relaxed));
+    method_cache.store(cache->assoc(dispatch_value, method).data, std::memory_order_release);
+    return method;
+  }
+
+  object_ptr multi_fn::call() const
+  {
+    return dynamic_call(find_method(dispatch_site.call(dispatch_fn)));
+  }
+
+  object_ptr multi_fn::call(object_ptr const a1) const
+  {
+    return dynamic_call(find_method(dispatch_site.call(dispatch_fn, a1)), a1);
+  }
+
+  object_ptr multi_fn::call(object_ptr const a1, object_ptr const a2) const
+  {
+    return dynamic_call(find_method(dispatch_site.call(dispatch_fn, a1, a2)), a1, a2);
+  }
+
+  object_ptr multi_fn::call(object_ptr const a1, object_ptr const a2, object_ptr const a3) const
+  {
+    return dynamic_call(find_method(dispatch_site.call(dispatch_fn, a1, a2, a3)), a1, a2, a3);
+  }
+
+  object_ptr multi_fn::call(object_ptr const a1,
+                            object_ptr const a2,
+                            object_ptr const a3,
+                            object_ptr const a4) const
+  {
+    return dynamic_call(find_method(dispatch_site.call(dispatch_fn, a1, a2, a3, a4)),
+                        a1,
+                        a2,
+                        a3,
+                        a4);
+  }
+
+  object_ptr multi_fn::call(object_ptr const a1,
+                            object_ptr const a2,
+                            object_ptr const a3,
+                            object_ptr const a4,
+                            object_ptr const a5) const
+  {
+    return dynamic_call(find_method(dispatch_site.call(dispatch_fn, a1, a2, a3, a4, a5)),
+                        a1,
+                        a2,
+                        a3,
+                        a4,
+                        a5);
+  }
+
+  object_ptr multi_fn::call(object_ptr const a1,
+                            object_ptr const a2,
+                            object_ptr const a3,
+                            object_ptr const a4,
+                            object_ptr const a5,
+                            object_ptr const a6) const
+  {
+    return dynamic_call(find_method(dispatch_site.call(dispatch_fn, a1, a2, a3, a4, a5, a6)),
+                        a1,
+                        a2,
+                        a3,
+                        a4,
+                        a5,
+                        a6);
+  }
+
+  object_ptr multi_fn::call(object_ptr const a1,
+                            object_ptr const a2,
+                            object_ptr const a3,
+                            object_ptr const a4,
+                            object_ptr const a5,
+                            object_ptr const a6,
+                            object_ptr const a7) const
+  {
+    return dynamic_call(
+      find_method(dispatch_site.call(dispatch_fn, a1, a2, a3, a4, a5, a6, a7)),
+      a1,
+      a2,
+      a3,
+      a4,
+      a5,
+      a6,
+      a7);
+  }
+
+  object_ptr multi_fn::call(object_ptr const a1,
+                            object_ptr const a2,
+                            object_ptr const a3,
+                            object_ptr const a4,
+                            object_ptr const a5,
+                            object_ptr const a6,
+                            object_ptr const a7,
+                            object_ptr const a8) const
+  {
+    return dynamic_call(
+      find_method(dispatch_site.call(dispatch_fn, a1, a2, a3, a4, a5, a6, a7, a8)),
+      a1,
+      a2,
+      a3,
+      a4,
+      a5,
+      a6,
+      a7,
+      a8);
+  }
+
+  object_ptr multi_fn::call(object_ptr const a1,
+                            object_ptr const a2,
+                            object_ptr const a3,
+                            object_ptr const a4,
+                            object_ptr const a5,
+                            object_ptr const a6,
+                            object_ptr const a7,
+                            object_ptr const a8,
+                            object_ptr const a9) const
+  {
+    return dynamic_call(
+      find_method(dispatch_site.call(dispatch_fn, a1, a2, a3, a4, a5, a6, a7, a8, a9)),
+      a1,
+      a2,
+      a3,
+      a4,
+      a5,
+      a6,
+      a7,
+      a8,
+      a9);
+  }
+
+  object_ptr multi_fn::call(object_ptr const a1,
+                            object_ptr const a2,
+                            object_ptr const a3,
+                            object_ptr const a4,
+                            object_ptr const a5,
+                            object_ptr const a6,
+                            object_ptr const a7,
+                            object_ptr const a8,
+                            object_ptr const a9,
+                            object_ptr const a10) const
+  {
+    return dynamic_call(
+      find_method(dispatch_site.call(dispatch_fn, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10)),
+      a1,
+      a2,
+      a3,
+      a4,
+      a5,
+      a6,
+      a7,
+      a8,
+      a9,
+      a10);
+  }
+
+  native_bool is_multi_fn(object_ptr const o)
+  {
+    return o->type == object_type::jit_function
+      && dynamic_cast<multi_fn *>(expect_object<obj::jit_function>(o).data);
+  }
+
+  multi_fn_ptr expect_multi_fn(object_ptr const o)
+  {
+    multi_fn *fn{};
+    if(o->type == object_type::jit_function)
+    {
+      fn = dynamic_cast<multi_fn *>(expect_object<obj::jit_function>(o).data);
+    }
+    if(!fn)
+    {
+      throw std::runtime_error{ fmt::format("not a multimethod: {}", detail::to_string(o)) };
+    }
+    return fn;
+  }
+}
@@ -56,15 +56,14 @@ namespace jank::runtime
   {
     constexpr size_t arg_count{ sizeof...(Args) };
     using arity = typename build_arity<arg_count>::type;
-    using function_type = obj::detail::function_type::value_type<arity>;
 
-    auto const * const func_ptr(f.data.template get<function_type>());
+    auto const func_ptr(f.data.arities[arg_count]);
     if(!func_ptr)
     {
       throw std::runtime_error{ fmt::format("invalid function arity; tried {}", arg_count) };
     }
 
-    return (*func_ptr)(std::forward<Args>(args)...);
+    return reinterpret_cast<arity *>(func_ptr)(std::forward<Args>(args)...);
   }
 
   object_ptr obj::native_function_wrapper::call() const
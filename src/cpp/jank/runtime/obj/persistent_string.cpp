@@ -5,6 +5,7 @@
 
 #include <jank/runtime/util.hpp>
 #include <jank/runtime/obj/persistent_string.hpp>
+#include <jank/runtime/obj/transient_string.hpp>
 
 namespace jank::runtime
 {
@@ -44,6 +45,11 @@ namespace jank::runtime
     return data.to_hash();
   }
 
+  obj::transient_string_ptr obj::persistent_string::to_transient() const
+  {
+    return make_box<obj::transient_string>(data);
+  }
+
   result<obj::persistent_string_ptr, native_persistent_string>
   obj::persistent_string::substring(native_integer start) const
   {
@@ -0,0 +1,72 @@
+namespace jank::runtime
+{
+  obj::transient_string::static_object(native_persistent_string const &d)
+    : data{ d.begin(), d.end() }
+  {
+  }
+
+  native_bool obj::transient_string::equal(object const &o) const
+  {
+    /* Transient equality, in Clojure, is based solely on identity. */
+    return &base == &o;
+  }
+
+  native_persistent_string obj::transient_string::to_string() const
+  {
+    if(data.empty())
+    {
+      return {};
+    }
+    return native_persistent_string{ data.data(), data.size() };
+  }
+
+  void obj::transient_string::to_string(fmt::memory_buffer &buff) const
+  {
+    buff.append(data.data(), data.data() + data.size());
+  }
+
+  native_hash obj::transient_string::to_hash() const
+  {
+    /* Hash is also based only on identity. Clojure uses default hashCode, which does the same. */
+    return static_cast<native_hash>(reinterpret_cast<uintptr_t>(this));
+  }
+
+  size_t obj::transient_string::count() const
+  {
+    assert_active();
+    return data.size();
+  }
+
+  obj::transient_string_ptr obj::transient_string::cons_in_place(object_ptr const head)
+  {
+    assert_active();
+    /* Strings are the common case, so they're copied straight in. */
+    if(head->type == object_type::persistent_string)
+    {
+      auto const &s(expect_object<obj::persistent_string>(head)->data);
+      data.insert(data.end(), s.begin(), s.end());
+    }
+    else
+    {
+      fmt::memory_buffer buff;
+      runtime::detail::to_string(head, buff);
+      data.insert(data.end(), buff.begin(), buff.end());
+    }
+    return this;
+  }
+
+  native_box<obj::transient_string::persistent_type> obj::transient_string::to_persistent()
+  {
+    assert_active();
+    active = false;
+    return make_box<obj::persistent_string>(to_string());
+  }
+
+  void obj::transient_string::assert_active() const
+  {
+    if(!active)
+    {
+      throw std::runtime_error{ "transient used after it's been made persistent" };
+    }
+  }
+}
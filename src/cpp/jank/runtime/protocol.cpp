@@ -0,0 +1,212 @@
+#include <algorithm>
+
+#include <fmt/core.h>
+
+#include <jank/runtime/protocol.hpp>
+#include <jank/runtime/call_site_cache.hpp>
+#include <jank/runtime/detail/object_util.hpp>
+
+namespace jank::runtime
+{
+  protocol_method::protocol_method(native_persistent_string const &name)
+    : name{ name }
+  {
+  }
+
+  void protocol_method::extend(option<object_type> const &type, object_ptr const fn)
+  {
+    impl i{ fn };
+    auto const * const c(call_site_cache::to_callable(fn));
+    if(c && !(c->get_arity_flags() & behavior::callable::mask_variadic_arity(0)))
+    {
+      i.direct = c;
+    }
+
+    if(type.is_none())
+    {
+      default_impl = i;
+    }
+    else
+    {
+      impls[static_cast<size_t>(type.unwrap())] = i;
+    }
+  }
+
+  native_bool protocol_method::is_extended(object_type const type) const
+  {
+    return impls[static_cast<size_t>(type)].fn || default_impl.fn;
+  }
+
+  protocol_method::impl const &protocol_method::find_impl(object_ptr const o) const
+  {
+    auto const &found(impls[static_cast<size_t>(o->type)]);
+    if(found.fn)
+    {
+      return found;
+    }
+    else if(default_impl.fn)
+    {
+      return default_impl;
+    }
+
+    throw std::runtime_error{ fmt::format("no impl of protocol method {} for {}",
+                                          name,
+                                          magic_enum::enum_name(o->type)) };
+  }
+
+  object_ptr protocol_method::call(object_ptr const a1) const
+  {
+    auto const &i(find_impl(a1));
+    return i.direct ? i.direct->call(a1) : dynamic_call(i.fn, a1);
+  }
+
+  object_ptr protocol_method::call(object_ptr const a1, object_ptr const a2) const
+  {
+    auto const &i(find_impl(a1));
+    return i.direct ? i.direct->call(a1, a2) : dynamic_call(i.fn, a1, a2);
+  }
+
+  object_ptr
+  protocol_method::call(object_ptr const a1, object_ptr const a2, object_ptr const a3) const
+  {
+    auto const &i(find_impl(a1));
+    return i.direct ? i.direct->call(a1, a2, a3) : dynamic_call(i.fn, a1, a2, a3);
+  }
+
+  object_ptr protocol_method::call(object_ptr const a1,
+                                   object_ptr const a2,
+                                   object_ptr const a3,
+                                   object_ptr const a4) const
+  {
+    auto const &i(find_impl(a1));
+    return i.direct ? i.direct->call(a1, a2, a3, a4) : dynamic_call(i.fn, a1, a2, a3, a4);
+  }
+
+  object_ptr protocol_method::call(object_ptr const a1,
+                                   object_ptr const a2,
+                                   object_ptr const a3,
+                                   object_ptr const a4,
+                                   object_ptr const a5) const
+  {
+    auto const &i(find_impl(a1));
+    return i.direct ? i.direct->call(a1, a2, a3, a4, a5)
+                    : dynamic_call(i.fn, a1, a2, a3, a4, a5);
+  }
+
+  object_ptr protocol_method::call(object_ptr const a1,
+                                   object_ptr const a2,
+                                   object_ptr const a3,
+                                   object_ptr const a4,
+                                   object_ptr const a5,
+                                   object_ptr const a6) const
+  {
+    auto const &i(find_impl(a1));
+    return i.direct ? i.direct->call(a1, a2, a3, a4, a5, a6)
+                    : dynamic_call(i.fn, a1, a2, a3, a4, a5, a6);
+  }
+
+  object_ptr protocol_method::call(object_ptr const a1,
+                                   object_ptr const a2,
+                                   object_ptr const a3,
+                                   object_ptr const a4,
+                                   object_ptr const a5,
+                                   object_ptr const a6,
+                                   object_ptr const a7) const
+  {
+    auto const &i(find_impl(a1));
+    return i.direct ? i.direct->call(a1, a2, a3, a4, a5, a6, a7)
+                    : dynamic_call(i.fn, a1, a2, a3, a4, a5, a6, a7);
+  }
+
+  object_ptr protocol_method::call(object_ptr const a1,
+                                   object_ptr const a2,
+                                   object_ptr const a3,
+                                   object_ptr const a4,
+                                   object_ptr const a5,
+                                   object_ptr const a6,
+                                   object_ptr const a7,
+                                   object_ptr const a8) const
+  {
+    auto const &i(find_impl(a1));
+    return i.direct ? i.direct->call(a1, a2, a3, a4, a5, a6, a7, a8)
+                    : dynamic_call(i.fn, a1, a2, a3, a4, a5, a6, a7, a8);
+  }
+
+  object_ptr protocol_method::call(object_ptr const a1,
+                                   object_ptr const a2,
+                                   object_ptr const a3,
+                                   object_ptr const a4,
+                                   object_ptr const a5,
+                                   object_ptr const a6,
+                                   object_ptr const a7,
+                                   object_ptr const a8,
+                                   object_ptr const a9) const
+  {
+    auto const &i(find_impl(a1));
+    return i.direct ? i.direct->call(a1, a2, a3, a4, a5, a6, a7, a8, a9)
+                    : dynamic_call(i.fn, a1, a2, a3, a4, a5, a6, a7, a8, a9);
+  }
+
+  object_ptr protocol_method::call(object_ptr const a1,
+                                   object_ptr const a2,
+                                   object_ptr const a3,
+                                   object_ptr const a4,
+                                   object_ptr const a5,
+                                   object_ptr const a6,
+                                   object_ptr const a7,
+                                   object_ptr const a8,
+                                   object_ptr const a9,
+                                   object_ptr const a10) const
+  {
+    auto const &i(find_impl(a1));
+    return i.direct ? i.direct->call(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10)
+                    : dynamic_call(i.fn, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10);
+  }
+
+  protocol_method_ptr expect_protocol_method(object_ptr const o)
+  {
+    protocol_method *method{};
+    if(o->type == object_type::jit_function)
+    {
+      method = dynamic_cast<protocol_method *>(expect_object<obj::jit_function>(o).data);
+    }
+    if(!method)
+    {
+      throw std::runtime_error{ fmt::format("not a protocol method: {}", detail::to_string(o)) };
+    }
+    return method;
+  }
+
+  option<object_type> protocol_type(object_ptr const type_name)
+  {
+    native_persistent_string name;
+    switch(type_name->type)
+    {
+      case object_type::nil:
+        return object_type::nil;
+      case object_type::keyword:
+        name = expect_object<obj::keyword>(type_name)->sym.name;
+        break;
+      case object_type::symbol:
+        name = expect_object<obj::symbol>(type_name)->name;
+        break;
+      default:
+        throw std::runtime_error{ fmt::format("invalid protocol type: {}",
+                                              detail::to_string(type_name)) };
+    }
+
+    if(name == "default")
+    {
+      return none;
+    }
+
+    std::string native_name{ name.data(), name.size() };
+    std::replace(native_name.begin(), native_name.end(), '-', '_');
+    auto const type(magic_enum::enum_cast<object_type>(native_name));
+    if(!type.has_value())
+    {
+      throw std::runtime_error{ fmt::format("unknown protocol type: {}", name) };
+    }
+    return type.value();
+  }
+}
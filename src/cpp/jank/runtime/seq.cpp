@@ -13,6 +13,7 @@
 #include <jank/runtime/obj/persistent_array_map.hpp>
 #include <jank/runtime/obj/persistent_vector.hpp>
 #include <jank/runtime/seq.hpp>
+#include <jank/runtime/math.hpp>
 #include <jank/runtime/util.hpp>
 
 namespace jank::runtime
@@ -262,6 +263,12 @@ namespace jank::runtime
 
   object_ptr assoc(object_ptr const m, object_ptr const k, object_ptr const v)
   {
+    /* Like Clojure, nil is treated as an empty map. */
+    if(m == obj::nil::nil_const())
+    {
+      return obj::persistent_array_map::create_unique(k, v);
+    }
+
     return visit_object(
       [&](auto const typed_m) -> object_ptr {
         using T = typename decltype(typed_m)::value_type;
@@ -315,6 +322,43 @@ namespace jank::runtime
       m);
   }
 
+  object_ptr keyword_get(obj::keyword_ptr const k, object_ptr const m)
+  {
+    return keyword_get(k, m, obj::nil::nil_const());
+  }
+
+  /* Keywords are interned, so array maps can be scanned for the keyword's address alone.
+   * Hash maps hash the key, but keywords cache their hash. Both skip `get`'s type dispatch
+   * and, for array maps, the check for the key's type. */
+  object_ptr
+  keyword_get(obj::keyword_ptr const k, object_ptr const m, object_ptr const fallback)
+  {
+    object_ptr const key{ k };
+    if(m->type == object_type::persistent_array_map)
+    {
+      auto const &data(expect_object<obj::persistent_array_map>(m)->data);
+      for(size_t i{}; i < data.length; i += 2)
+      {
+        if(data.data[i] == key)
+        {
+          return data.data[i + 1];
+        }
+      }
+      return fallback;
+    }
+    else if(m->type == object_type::persistent_hash_map)
+    {
+      auto const res(expect_object<obj::persistent_hash_map>(m)->data.find(key));
+      if(res)
+      {
+        return *res;
+      }
+      return fallback;
+    }
+
+    return get(m, key, fallback);
+  }
+
   object_ptr get_in(object_ptr m, object_ptr keys)
   {
     return visit_object(
@@ -392,6 +436,75 @@ namespace jank::runtime
       m);
   }
 
+  native_integer count(object_ptr const s)
+  {
+    return static_cast<native_integer>(detail::sequence_length(s));
+  }
+
+  /* When there's no fallback, an out of bounds index is an error. */
+  static object_ptr
+  nth_impl(object_ptr const o, object_ptr const index, option<object_ptr> const &fallback)
+  {
+    auto const i(to_int(index));
+    auto const out_of_bounds([&]() -> object_ptr {
+      if(fallback.is_some())
+      {
+        return fallback.unwrap();
+      }
+      throw std::runtime_error{ fmt::format("index out of bounds: {}", i) };
+    });
+
+    if(i < 0)
+    {
+      return out_of_bounds();
+    }
+
+    return visit_object(
+      [&](auto const typed_o) -> object_ptr {
+        using T = typename decltype(typed_o)::value_type;
+
+        if constexpr(std::same_as<T, obj::nil>)
+        {
+          return fallback.unwrap_or(typed_o);
+        }
+        else if constexpr(std::same_as<T, obj::persistent_vector>)
+        {
+          if(typed_o->data.size() <= static_cast<size_t>(i))
+          {
+            return out_of_bounds();
+          }
+          return typed_o->data[i];
+        }
+        else if constexpr(behavior::seqable<T>)
+        {
+          native_integer n{};
+          for(auto it(typed_o->fresh_seq()); it != nullptr; it = it->next_in_place(), ++n)
+          {
+            if(n == i)
+            {
+              return it->first();
+            }
+          }
+          return out_of_bounds();
+        }
+        else
+        {
+          throw std::runtime_error{ fmt::format("nth not supported on: {}", typed_o->to_string()) };
+        }
+      },
+      o);
+  }
+
+  object_ptr nth(object_ptr const o, object_ptr const index)
+  {
+    return nth_impl(o, index, none);
+  }
+
+  object_ptr nth(object_ptr const o, object_ptr const index, object_ptr const fallback)
+  {
+    return nth_impl(o, index, fallback);
+  }
+
   object_ptr find(object_ptr const s, object_ptr const key)
   {
     auto const nil(obj::nil::nil_const());
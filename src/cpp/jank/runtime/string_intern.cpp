@@ -0,0 +1,59 @@
+#include <mutex>
+#include <stdexcept>
+
+#include <jank/runtime/string_intern.hpp>
+#include <jank/runtime/weak_table.hpp>
+#include <jank/runtime/erasure.hpp>
+#include <jank/runtime/detail/object_util.hpp>
+
+namespace jank::runtime
+{
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+  static std::mutex table_mutex;
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+  static weak_table table;
+
+  template <typename F>
+  static obj::persistent_string_ptr find_or_insert(native_persistent_string const &s, F const &make)
+  {
+    std::lock_guard<std::mutex> const lock{ table_mutex };
+    auto const hash(s.to_hash());
+    for(auto * const o : table.find(hash))
+    {
+      auto const str(expect_object<obj::persistent_string>(o));
+      if(str->data == s)
+      {
+        return str;
+      }
+    }
+
+    obj::persistent_string_ptr const ret{ make() };
+    table.insert(hash, ret);
+    return ret;
+  }
+
+  obj::persistent_string_ptr intern_string(native_persistent_string const &s)
+  {
+    return find_or_insert(s, [&] { return make_box<obj::persistent_string>(s); });
+  }
+
+  obj::persistent_string_ptr intern_string(obj::persistent_string_ptr const s)
+  {
+    return find_or_insert(s->data, [&] { return s; });
+  }
+
+  size_t interned_string_count()
+  {
+    std::lock_guard<std::mutex> const lock{ table_mutex };
+    return table.size();
+  }
+
+  object_ptr intern_str(object_ptr const o)
+  {
+    if(o->type != object_type::persistent_string)
+    {
+      throw std::runtime_error{ fmt::format("not a string: {}", detail::to_string(o)) };
+    }
+    return intern_string(expect_object<obj::persistent_string>(o));
+  }
+}
@@ -43,11 +43,6 @@ namespace jank::runtime
     {
       return o && o->data;
     }
-
-    bool truthy(native_bool const o)
-    {
-      return o;
-    }
   }
 
   static native_unordered_map<char, native_persistent_string_view> const munge_chars{
@@ -0,0 +1,96 @@
+#include <algorithm>
+#include <stdexcept>
+
+#include <gc/gc.h>
+
+#include <jank/runtime/weak_table.hpp>
+
+namespace jank::runtime
+{
+  weak_table::~weak_table()
+  {
+    for(auto const &bucket : buckets)
+    {
+      for(auto * const l : bucket.second)
+      {
+        GC_unregister_disappearing_link(reinterpret_cast<void **>(l));
+        GC_FREE(l);
+      }
+    }
+  }
+
+  struct weak_lookup
+  {
+    std::vector<weak_table::link *> &bucket;
+    native_vector<object *> &found;
+    /* Live links are moved to the front. The rest have been cleared, so they can be freed
+     * once the lock is released. */
+    size_t live{};
+  };
+
+  /* The GC may clear links at any point, so they're only read with the allocation lock
+   * held. This mustn't allocate, so the result already has room for the whole bucket. */
+  static void *find_live(void * const data)
+  {
+    auto &l(*static_cast<weak_lookup *>(data));
+    auto const dead(std::partition(l.bucket.begin(),
+                                   l.bucket.end(),
+                                   [](weak_table::link const * const link) { return *link != 0; }));
+    l.live = static_cast<size_t>(dead - l.bucket.begin());
+
+    for(auto it(l.bucket.begin()); it != dead; ++it)
+    {
+      l.found.push_back(static_cast<object *>(GC_REVEAL_POINTER(**it)));
+    }
+    return nullptr;
+  }
+
+  native_vector<object *> weak_table::find(native_hash const hash)
+  {
+    auto &bucket(buckets[hash]);
+    native_vector<object *> ret;
+    ret.reserve(bucket.size());
+
+    weak_lookup l{ bucket, ret };
+    GC_call_with_alloc_lock(&find_live, &l);
+    for(auto it(bucket.begin() + static_cast<std::ptrdiff_t>(l.live)); it != bucket.end(); ++it)
+    {
+      GC_FREE(*it);
+    }
+    bucket.resize(l.live);
+
+    return ret;
+  }
+
+  void weak_table::insert(native_hash const hash, object * const o)
+  {
+    auto * const base(GC_base(o));
+    if(!base)
+    {
+      return;
+    }
+
+    auto * const l(static_cast<link *>(GC_MALLOC_ATOMIC_UNCOLLECTABLE(sizeof(link))));
+    if(!l)
+    {
+      throw std::runtime_error{ "unable to allocate weak link" };
+    }
+    *l = GC_HIDE_POINTER(o);
+    if(GC_general_register_disappearing_link(reinterpret_cast<void **>(l), base) == GC_NO_MEMORY)
+    {
+      GC_FREE(l);
+      throw std::runtime_error{ "unable to register weak link" };
+    }
+    buckets[hash].push_back(l);
+  }
+
+  size_t weak_table::size() const
+  {
+    size_t ret{};
+    for(auto const &bucket : buckets)
+    {
+      ret += bucket.second.size();
+    }
+    return ret;
+  }
+}
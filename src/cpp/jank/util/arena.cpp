@@ -0,0 +1,68 @@
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+
+#include <gc/gc.h>
+
+#include <jank/util/arena.hpp>
+
+namespace jank::util
+{
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+  static thread_local arena *current_arena{};
+
+  arena::~arena()
+  {
+    for(auto const chunk : chunks)
+    {
+      GC_FREE(chunk);
+    }
+  }
+
+  void *arena::allocate(size_t const size, size_t const alignment)
+  {
+    void *ptr(cursor);
+    size_t space(static_cast<size_t>(end - cursor));
+    if(cursor && std::align(alignment, size, ptr, space))
+    {
+      cursor = static_cast<char *>(ptr) + size;
+      return ptr;
+    }
+
+    /* Anything which wouldn't leave room for much else gets a chunk of its own, so we
+     * don't throw away the rest of the current one. */
+    auto const chunk_bytes(std::max(chunk_size, size + alignment));
+    auto * const chunk(static_cast<char *>(GC_MALLOC_UNCOLLECTABLE(chunk_bytes)));
+    if(!chunk)
+    {
+      throw std::runtime_error{ "unable to allocate arena chunk" };
+    }
+    chunks.push_back(chunk);
+
+    ptr = chunk;
+    space = chunk_bytes;
+    std::align(alignment, size, ptr, space);
+    if(size * 2 < chunk_size)
+    {
+      cursor = static_cast<char *>(ptr) + size;
+      end = chunk + chunk_bytes;
+    }
+    return ptr;
+  }
+
+  arena::scope::scope(arena &a)
+    : previous{ current_arena }
+  {
+    current_arena = &a;
+  }
+
+  arena::scope::~scope()
+  {
+    current_arena = previous;
+  }
+
+  arena *arena::current()
+  {
+    return current_arena;
+  }
+}
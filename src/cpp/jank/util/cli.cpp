@@ -23,9 +23,32 @@ namespace jank::util::cli
     cli.add_option("--profile-output",
                    opts.profiler_file,
                    "The file to write profile entries (will be overwritten)");
+    cli.add_option("--alloc-profile",
+                   opts.alloc_sample_rate,
+                   "Sample every Nth allocation, attributing it to the jank fn which made it")
+      ->check(CLI::PositiveNumber);
+    cli.add_option("--alloc-profile-output",
+                   opts.alloc_profile_file,
+                   "The file to write allocation samples, as folded stacks (will be overwritten)");
     cli.add_flag("--gc-incremental", opts.gc_incremental, "Enable incremental GC collection");
+    cli.add_option("--gc-initial-heap", opts.gc_initial_heap, "The initial GC heap size, like 64MB")
+      ->transform(CLI::AsSizeValue(false));
+    cli.add_option("--gc-max-heap", opts.gc_max_heap, "The maximum GC heap size, like 2GB")
+      ->transform(CLI::AsSizeValue(false));
+    cli.add_option("--gc-markers", opts.gc_markers, "The number of GC marker threads")
+      ->check(CLI::PositiveNumber);
+    cli.add_option("--gc-free-space-divisor",
+                   opts.gc_free_space_divisor,
+                   "Higher values collect more often, using less memory")
+      ->check(CLI::PositiveNumber);
+    cli.add_flag("--intern-strings",
+                 opts.intern_strings,
+                 "Intern string literals as they're read, so identical ones share memory");
     cli.add_option("-O,--optimization", opts.optimization_level, "The optimization level to use")
       ->check(CLI::Range(0, 3));
+    cli.add_flag("--direct-link",
+                 opts.direct_linking,
+                 "Compile calls to known fns as direct calls, skipping their vars");
 
     /* Run subcommand. */
     auto &cli_run(*cli.add_subcommand("run", "Load and run a file"));
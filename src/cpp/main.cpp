@@ -18,6 +18,7 @@
 #include <jank/read/lex.hpp>
 #include <jank/read/parse.hpp>
 #include <jank/runtime/context.hpp>
+#include <jank/runtime/gc.hpp>
 #include <jank/analyze/processor.hpp>
 #include <jank/codegen/processor.hpp>
 #include <jank/evaluate.hpp>
@@ -75,6 +76,7 @@ namespace jank
         {
           extra_args.push_back(make_box<runtime::obj::persistent_string>(s));
         }
+        jit::entry const running;
         runtime::apply_to(main_var->deref(),
                           make_box<runtime::obj::persistent_vector>(extra_args.persistent()));
       }
@@ -125,6 +127,8 @@ namespace jank
       add_history(line.data());
       try
       {
+        /* Nothing JIT compiled is running between inputs, so this is where old code goes. */
+        rt_ctx.jit_prc.unload_unreachable();
         auto const res(rt_ctx.eval_string(line));
         fmt::println("{}", runtime::detail::to_string(res));
       }
@@ -156,7 +160,13 @@ try
   using namespace jank;
 
   /* The GC needs to enabled even before arg parsing, since our native types,
-   * like strings, use the GC for allocations. It can still be configured later. */
+   * like strings, use the GC for allocations. It can still be configured later, by
+   * `configure_gc`, though the marker count only applies if the GC hasn't been initialized.
+   *
+   * Interior pointers need to stay on. An object_ptr points at an object's `base`, which
+   * isn't always at the start of its allocation, and immer and folly keep pointers into the
+   * middle of their nodes. Typed layouts, from `gc_layout`, narrow down which words of an
+   * object are scanned, but not what those words may point into. */
   GC_set_all_interior_pointers(1);
   GC_enable();
 
@@ -167,12 +177,10 @@ try
   }
   auto const &opts(parse_result.expect_ok());
 
-  if(opts.gc_incremental)
-  {
-    GC_enable_incremental();
-  }
+  runtime::configure_gc(opts);
 
   profile::configure(opts);
+  profile::configure_alloc(opts);
   profile::timer timer{ "main" };
 
   runtime::context rt_ctx{ opts };
@@ -192,6 +200,8 @@ try
       run_main(opts, rt_ctx);
       break;
   }
+
+  timer.report("main");
 }
 /* TODO: Unify error handling. JEEZE! */
 catch(std::exception const &e)
@@ -202,6 +202,61 @@ namespace jank::analyze
         CHECK(
           equal(runtime::get(captured_a_binding, make_box("has_unboxed_usage")), make_box(false)));
       }
+
+      SUBCASE("Loop local")
+      {
+        auto const res(rt_ctx.analyze_string("(loop* [a 1 b :b] (recur a b))"));
+        CHECK_EQ(res.size(), 1);
+
+        auto const map(res[0]->to_runtime_data());
+
+        auto const a_binding(runtime::get_in(map, rt_ctx.eval_string(R"(["pairs" 0 0])")));
+        CHECK(equal(runtime::get(a_binding, make_box("needs_box")), make_box(false)));
+        CHECK(equal(runtime::get(a_binding, make_box("has_boxed_usage")), make_box(false)));
+        CHECK(equal(runtime::get(a_binding, make_box("has_unboxed_usage")), make_box(true)));
+        CHECK(equal(runtime::get(a_binding, make_box("unboxed_type")), make_box("integer")));
+
+        auto const b_binding(runtime::get_in(map, rt_ctx.eval_string(R"(["pairs" 1 0])")));
+        CHECK(equal(runtime::get(b_binding, make_box("needs_box")), make_box(true)));
+        CHECK(equal(runtime::get(b_binding, make_box("unboxed_type")), make_box("none")));
+      }
+
+      SUBCASE("Loop local with a mismatched recur")
+      {
+        auto const res(
+          rt_ctx.analyze_string("(loop* [a 1 b 2 c [1.5]] (recur (+ a 0.5) (inc b) (first c)))"));
+        CHECK_EQ(res.size(), 1);
+
+        auto const map(res[0]->to_runtime_data());
+
+        auto const a_binding(runtime::get_in(map, rt_ctx.eval_string(R"(["pairs" 0 0])")));
+        CHECK(equal(runtime::get(a_binding, make_box("needs_box")), make_box(true)));
+        CHECK(equal(runtime::get(a_binding, make_box("unboxed_type")), make_box("none")));
+
+        auto const b_binding(runtime::get_in(map, rt_ctx.eval_string(R"(["pairs" 1 0])")));
+        CHECK(equal(runtime::get(b_binding, make_box("needs_box")), make_box(false)));
+        CHECK(equal(runtime::get(b_binding, make_box("unboxed_type")), make_box("integer")));
+      }
+
+      SUBCASE("Loop local given another boxed loop local")
+      {
+        auto const res(rt_ctx.analyze_string(
+          "(loop* [a 1 b 2 c 3] (if (< a 10) (let* [c 1.5] (recur b c 3)) (do (recur 1 2 c))))"));
+        CHECK_EQ(res.size(), 1);
+
+        auto const map(res[0]->to_runtime_data());
+
+        /* b gets the real c from the let*, then a gets the boxed b. */
+        auto const a_binding(runtime::get_in(map, rt_ctx.eval_string(R"(["pairs" 0 0])")));
+        CHECK(equal(runtime::get(a_binding, make_box("needs_box")), make_box(true)));
+
+        auto const b_binding(runtime::get_in(map, rt_ctx.eval_string(R"(["pairs" 1 0])")));
+        CHECK(equal(runtime::get(b_binding, make_box("needs_box")), make_box(true)));
+
+        auto const c_binding(runtime::get_in(map, rt_ctx.eval_string(R"(["pairs" 2 0])")));
+        CHECK(equal(runtime::get(c_binding, make_box("needs_box")), make_box(false)));
+        CHECK(equal(runtime::get(c_binding, make_box("unboxed_type")), make_box("integer")));
+      }
     }
 
     TEST_CASE("Boxed local")
@@ -240,5 +295,82 @@ namespace jank::analyze
         CHECK(equal(runtime::get(a_binding, make_box("has_unboxed_usage")), make_box(false)));
       }
     }
+
+    TEST_CASE("Stack allocated fn")
+    {
+      runtime::context rt_ctx;
+      auto const f_binding_path(rt_ctx.eval_string(R"(["pairs" 0 0])"));
+
+      SUBCASE("Only called directly")
+      {
+        auto const res(rt_ctx.analyze_string("(let* [f (fn* [a] a)] (f 1) (f 2))"));
+        CHECK_EQ(res.size(), 1);
+
+        auto const f_binding(runtime::get_in(res[0]->to_runtime_data(), f_binding_path));
+        CHECK(equal(runtime::get(f_binding, make_box("is_stack_allocated")), make_box(true)));
+      }
+
+      SUBCASE("Used as a value")
+      {
+        auto const res(rt_ctx.analyze_string("(let* [f (fn* [a] a)] (f 1) f)"));
+        CHECK_EQ(res.size(), 1);
+
+        auto const f_binding(runtime::get_in(res[0]->to_runtime_data(), f_binding_path));
+        CHECK(equal(runtime::get(f_binding, make_box("is_stack_allocated")), make_box(false)));
+      }
+
+      SUBCASE("Captured")
+      {
+        auto const res(rt_ctx.analyze_string("(let* [f (fn* [a] a)] (fn* [] (f 1)))"));
+        CHECK_EQ(res.size(), 1);
+
+        auto const f_binding(runtime::get_in(res[0]->to_runtime_data(), f_binding_path));
+        CHECK(equal(runtime::get(f_binding, make_box("is_stack_allocated")), make_box(false)));
+      }
+
+      SUBCASE("Called with a missing arity")
+      {
+        auto const res(rt_ctx.analyze_string("(let* [f (fn* [a] a)] (f 1 2))"));
+        CHECK_EQ(res.size(), 1);
+
+        auto const f_binding(runtime::get_in(res[0]->to_runtime_data(), f_binding_path));
+        CHECK(equal(runtime::get(f_binding, make_box("is_stack_allocated")), make_box(false)));
+      }
+
+      SUBCASE("Variadic")
+      {
+        auto const res(rt_ctx.analyze_string("(let* [f (fn* [& a] a)] (f 1))"));
+        CHECK_EQ(res.size(), 1);
+
+        auto const f_binding(runtime::get_in(res[0]->to_runtime_data(), f_binding_path));
+        CHECK(equal(runtime::get(f_binding, make_box("is_stack_allocated")), make_box(false)));
+      }
+    }
+
+    TEST_CASE("Unboxed condition")
+    {
+      runtime::context rt_ctx;
+      rt_ctx.load_module("/clojure.core").expect_ok();
+
+      SUBCASE("Predicate with unboxed output")
+      {
+        auto const res(rt_ctx.analyze_string("(if (nil? 1) :a :b)"));
+        CHECK_EQ(res.size(), 1);
+
+        auto const map(res[0]->to_runtime_data());
+        auto const condition(runtime::get(map, make_box("condition")));
+        CHECK(equal(runtime::get(condition, make_box("needs_box")), make_box(false)));
+      }
+
+      SUBCASE("Fn without unboxed output")
+      {
+        auto const res(rt_ctx.analyze_string("(if (first [1]) :a :b)"));
+        CHECK_EQ(res.size(), 1);
+
+        auto const map(res[0]->to_runtime_data());
+        auto const condition(runtime::get(map, make_box("condition")));
+        CHECK(equal(runtime::get(condition, make_box("needs_box")), make_box(true)));
+      }
+    }
   }
 }
@@ -0,0 +1,88 @@
+#include <jank/runtime/context.hpp>
+#include <jank/jit/processor.hpp>
+
+/* This must go last; doctest and glog both define CHECK and family. */
+#include <doctest/doctest.h>
+
+namespace jank::analyze
+{
+  using runtime::detail::equal;
+
+  TEST_SUITE("analyze::fold")
+  {
+    TEST_CASE("Pure calls")
+    {
+      runtime::context rt_ctx;
+      rt_ctx.load_module("/clojure.core").expect_ok();
+
+      SUBCASE("Constant args")
+      {
+        auto const res(rt_ctx.analyze_string("(+ 1 (* 2 3))"));
+        CHECK_EQ(res.size(), 1);
+
+        auto const map(res[0]->to_runtime_data());
+        CHECK(equal(runtime::get(map, make_box("__type")), make_box("expr::primitive_literal")));
+        CHECK(equal(runtime::get(map, make_box("data")), make_box<runtime::obj::integer>(7)));
+      }
+
+      SUBCASE("Constant collections")
+      {
+        auto const res(rt_ctx.analyze_string(R"((str "a" (conj [1] 2) :b))"));
+        CHECK_EQ(res.size(), 1);
+
+        auto const map(res[0]->to_runtime_data());
+        CHECK(equal(runtime::get(map, make_box("__type")), make_box("expr::primitive_literal")));
+        CHECK(equal(runtime::get(map, make_box("data")), make_box("a[1 2]:b")));
+      }
+
+      SUBCASE("Non-constant args")
+      {
+        auto const res(rt_ctx.analyze_string("(let* [a (rand)] (+ a 1))"));
+        CHECK_EQ(res.size(), 1);
+
+        auto const map(res[0]->to_runtime_data());
+        auto const body(runtime::get_in(map, rt_ctx.eval_string(R"(["body" "body" 0])")));
+        CHECK(equal(runtime::get(body, make_box("__type")), make_box("expr::call")));
+      }
+
+      SUBCASE("Failing call")
+      {
+        auto const res(rt_ctx.analyze_string("(+ 1 :a)"));
+        CHECK_EQ(res.size(), 1);
+
+        auto const map(res[0]->to_runtime_data());
+        CHECK(equal(runtime::get(map, make_box("__type")), make_box("expr::call")));
+      }
+
+      SUBCASE("Throwing call")
+      {
+        auto const res(rt_ctx.analyze_string("(count 1)"));
+        CHECK_EQ(res.size(), 1);
+
+        auto const map(res[0]->to_runtime_data());
+        CHECK(equal(runtime::get(map, make_box("__type")), make_box("expr::call")));
+      }
+
+      SUBCASE("Marking as pure keeps existing meta")
+      {
+        auto const meta(rt_ctx.eval_string("(meta (var clojure.core/+))"));
+        CHECK(equal(runtime::get(meta, rt_ctx.intern_keyword("pure").expect_ok()),
+                    rt_ctx.intern_keyword("numbers").expect_ok()));
+        CHECK(equal(runtime::get(meta, rt_ctx.intern_keyword("inline").expect_ok()),
+                    make_box("jank::runtime::add")));
+      }
+    }
+
+    TEST_CASE("Impure calls")
+    {
+      runtime::context rt_ctx;
+      rt_ctx.load_module("/clojure.core").expect_ok();
+
+      auto const res(rt_ctx.analyze_string("(println 1)"));
+      CHECK_EQ(res.size(), 1);
+
+      auto const map(res[0]->to_runtime_data());
+      CHECK(equal(runtime::get(map, make_box("__type")), make_box("expr::call")));
+    }
+  }
+}
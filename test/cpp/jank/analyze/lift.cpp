@@ -0,0 +1,54 @@
+#include <jank/runtime/context.hpp>
+#include <jank/jit/processor.hpp>
+
+/* This must go last; doctest and glog both define CHECK and family. */
+#include <doctest/doctest.h>
+
+namespace jank::analyze
+{
+  using runtime::detail::equal;
+
+  TEST_SUITE("analyze::lift")
+  {
+    TEST_CASE("Shared across arities")
+    {
+      runtime::context rt_ctx;
+      rt_ctx.load_module("/clojure.core").expect_ok();
+
+      auto const res(
+        rt_ctx.analyze_string("(fn* ([] (println :k)) ([a] (println :k a)) ([a b] (rand)))"));
+      CHECK_EQ(res.size(), 1);
+      auto const map(res[0]->to_runtime_data());
+
+      SUBCASE("Vars")
+      {
+        auto const first(runtime::get_in(
+          map,
+          rt_ctx.eval_string(R"(["arities" 0 "frame" "lifted_vars" 'clojure.core/println])")));
+        auto const second(runtime::get_in(
+          map,
+          rt_ctx.eval_string(R"(["arities" 1 "frame" "lifted_vars" 'clojure.core/println])")));
+        CHECK(equal(runtime::get(first, make_box("native_name")),
+                    runtime::get(second, make_box("native_name"))));
+
+        /* The first arity collects every lifted var, even those it doesn't use itself. */
+        auto const rand(runtime::get_in(
+          map,
+          rt_ctx.eval_string(R"(["arities" 0 "frame" "lifted_vars" 'clojure.core/rand])")));
+        CHECK(!equal(rand, runtime::obj::nil::nil_const()));
+      }
+
+      SUBCASE("Constants")
+      {
+        auto const first(runtime::get_in(
+          map,
+          rt_ctx.eval_string(R"(["arities" 0 "frame" "lifted_constants" :k])")));
+        auto const second(runtime::get_in(
+          map,
+          rt_ctx.eval_string(R"(["arities" 1 "frame" "lifted_constants" :k])")));
+        CHECK(equal(runtime::get(first, make_box("native_name")),
+                    runtime::get(second, make_box("native_name"))));
+      }
+    }
+  }
+}
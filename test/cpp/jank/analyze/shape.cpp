@@ -0,0 +1,60 @@
+#include <jank/runtime/context.hpp>
+#include <jank/jit/processor.hpp>
+
+/* This must go last; doctest and glog both define CHECK and family. */
+#include <doctest/doctest.h>
+
+namespace jank::analyze
+{
+  using runtime::detail::equal;
+
+  TEST_SUITE("analyze::shape")
+  {
+    TEST_CASE("Let binding")
+    {
+      runtime::context rt_ctx;
+      auto const shape_path(rt_ctx.eval_string(R"(["pairs" 0 0 "shape" "data"])"));
+
+      SUBCASE("Vector literal")
+      {
+        auto const res(rt_ctx.analyze_string("(let* [v [1 (rand)]] v)"));
+        CHECK_EQ(res.size(), 1);
+
+        auto const shape(runtime::get_in(res[0]->to_runtime_data(), shape_path));
+        CHECK(equal(runtime::get(shape, make_box("type")), make_box("vector")));
+        CHECK(equal(runtime::get(shape, make_box("exact")), make_box(true)));
+        CHECK(equal(runtime::get(shape, make_box("size")), make_box(2)));
+      }
+
+      SUBCASE("Map literal")
+      {
+        auto const res(rt_ctx.analyze_string("(let* [m {:a 1 :b (rand)}] m)"));
+        CHECK_EQ(res.size(), 1);
+
+        auto const shape(runtime::get_in(res[0]->to_runtime_data(), shape_path));
+        CHECK(equal(runtime::get(shape, make_box("type")), make_box("map")));
+        CHECK(equal(runtime::get(shape, make_box("exact")), make_box(true)));
+        CHECK(equal(runtime::get(shape, make_box("keys")), rt_ctx.eval_string("[:a :b]")));
+      }
+
+      SUBCASE("Hinted")
+      {
+        auto const res(rt_ctx.analyze_string("(let* [^vector v (rand)] v)"));
+        CHECK_EQ(res.size(), 1);
+
+        auto const shape(runtime::get_in(res[0]->to_runtime_data(), shape_path));
+        CHECK(equal(runtime::get(shape, make_box("type")), make_box("vector")));
+        CHECK(equal(runtime::get(shape, make_box("exact")), make_box(false)));
+      }
+
+      SUBCASE("Unknown")
+      {
+        auto const res(rt_ctx.analyze_string("(let* [v (rand)] v)"));
+        CHECK_EQ(res.size(), 1);
+
+        auto const shape(runtime::get_in(res[0]->to_runtime_data(), shape_path));
+        CHECK(equal(shape, make_box("none")));
+      }
+    }
+  }
+}
@@ -1,12 +1,16 @@
 #include <filesystem>
 
 #include <boost/algorithm/string/predicate.hpp>
+#include <boost/core/demangle.hpp>
 #include <boost/filesystem.hpp>
 
 #include <fmt/color.h>
 
+#include <gc/gc.h>
+
 #include <jank/util/mapped_file.hpp>
 #include <jank/util/scope_exit.hpp>
+#include <jank/util/cli.hpp>
 #include <jank/read/lex.hpp>
 #include <jank/read/parse.hpp>
 #include <jank/runtime/obj/number.hpp>
@@ -176,5 +180,144 @@ namespace jank::jit
       }
       fmt::print("tested {} jank files\n", test_count);
     }
+
+    TEST_CASE("direct linking")
+    {
+      util::cli::options opts;
+      opts.direct_linking = true;
+      runtime::context rt_ctx{ opts };
+      rt_ctx.load_module("/clojure.core").expect_ok();
+
+      SUBCASE("fixed arity")
+      {
+        auto const res(rt_ctx.eval_string(R"((defn add-two [a b] (+ a b))
+                                              (defn call-add-two [] (add-two 1 2))
+                                              (call-add-two))"));
+        CHECK(runtime::detail::equal(res, make_box(3)));
+        CHECK(rt_ctx.direct_link_targets.contains(
+          rt_ctx.find_var("clojure.core", "add-two").unwrap()));
+      }
+
+      SUBCASE("linked calls keep the original fn")
+      {
+        auto const res(rt_ctx.eval_string(R"((defn linked [] 1)
+                                              (defn call-linked [] (linked))
+                                              (defn linked [] 2)
+                                              (call-linked))"));
+        CHECK(runtime::detail::equal(res, make_box(1)));
+      }
+
+      SUBCASE("redef")
+      {
+        auto const res(rt_ctx.eval_string(R"((def ^:redef unlinked (fn* [] 1))
+                                              (defn call-unlinked [] (unlinked))
+                                              (def unlinked (fn* [] 2))
+                                              (call-unlinked))"));
+        CHECK(runtime::detail::equal(res, make_box(2)));
+        CHECK(!rt_ctx.direct_link_targets.contains(
+          rt_ctx.find_var("clojure.core", "unlinked").unwrap()));
+      }
+
+      SUBCASE("variadic")
+      {
+        auto const res(rt_ctx.eval_string(R"((defn var-args [& args] (count args))
+                                              (defn call-var-args [] (var-args 1 2 3))
+                                              (call-var-args))"));
+        CHECK(runtime::detail::equal(res, make_box(3)));
+      }
+    }
+
+    TEST_CASE("rest args")
+    {
+      runtime::context rt_ctx;
+      rt_ctx.load_module("/clojure.core").expect_ok();
+
+      SUBCASE("borrowed")
+      {
+        auto const res(rt_ctx.eval_string(R"((defn count-rest [& xs] (count xs))
+                                              (count-rest 1 2 3))"));
+        CHECK(runtime::detail::equal(res, make_box(3)));
+      }
+
+      SUBCASE("escaping")
+      {
+        /* Returning the rest args means they need to outlive the caller's frame. */
+        auto const res(rt_ctx.eval_string(R"((defn keep-rest [& xs] xs)
+                                              (keep-rest 1 2 3))"));
+        CHECK(res->type == runtime::object_type::native_array_sequence);
+        CHECK(GC_is_heap_ptr(res.data));
+        CHECK(runtime::detail::equal(
+          res,
+          make_box<runtime::obj::persistent_vector>(std::in_place,
+                                                    make_box(1),
+                                                    make_box(2),
+                                                    make_box(3))));
+      }
+    }
+
+    TEST_CASE("unloading")
+    {
+      runtime::context rt_ctx;
+      rt_ctx.load_module("/clojure.core").expect_ok();
+
+      /* The GC is conservative, so fns may not be collected when we'd like. Instead, we take
+       * a fn's finalizer and run it ourselves, as the GC would once it's unreachable. */
+      auto const make_unreachable([](runtime::object_ptr const fn) {
+        auto * const base(GC_base(fn.data));
+        REQUIRE(base);
+        GC_finalization_proc finalizer{};
+        void *finalizer_data{};
+        GC_register_finalizer_no_order(base, nullptr, nullptr, &finalizer, &finalizer_data);
+        REQUIRE(finalizer);
+        finalizer(base, finalizer_data);
+      });
+      auto const type_name([](runtime::object_ptr const fn) {
+        return boost::core::demangle(
+          typeid(*runtime::expect_object<runtime::obj::jit_function>(fn)->data).name());
+      });
+      auto const type_exists([&](native_persistent_string const &type) {
+        cling::Value v;
+        return rt_ctx.jit_prc.interpreter->evaluate(fmt::format("sizeof({})", type), v)
+          == cling::Interpreter::CompilationResult::kSuccess;
+      });
+
+      rt_ctx.eval_string("(def reloaded (fn* [] 1))");
+      auto const old_fn(rt_ctx.find_var("clojure.core", "reloaded").unwrap()->deref());
+      auto const old_type(type_name(old_fn));
+      rt_ctx.eval_string("(def reloaded (fn* [] 2))");
+
+      /* The old fn's code is under the new fn's, which is still reachable. Cling can only
+       * revert its latest transaction, so it stays queued. */
+      make_unreachable(old_fn);
+      auto const queued(current_code_stats());
+      CHECK(queued.unreachable_units > 0);
+      CHECK(rt_ctx.jit_prc.unload_unreachable());
+      CHECK(current_code_stats().unloaded_units == queued.unloaded_units);
+      CHECK(current_code_stats().unreachable_units == queued.unreachable_units);
+      CHECK(type_exists(old_type));
+
+      /* A fn which was the last thing compiled can be unloaded, though. */
+      auto const latest_fn(rt_ctx.eval_string("(fn* [] 3)"));
+      auto const latest_type(type_name(latest_fn));
+      make_unreachable(latest_fn);
+
+      /* Nothing is unloaded while JIT compiled code may be running. */
+      {
+        entry const running;
+        CHECK(!rt_ctx.jit_prc.unload_unreachable());
+      }
+      CHECK(current_code_stats().unloaded_units == queued.unloaded_units);
+
+      CHECK(rt_ctx.jit_prc.unload_unreachable());
+      auto const after(current_code_stats());
+      CHECK(after.unloaded_units == queued.unloaded_units + 1);
+      CHECK(after.unloaded_bytes > queued.unloaded_bytes);
+      CHECK(after.unreachable_units == queued.unreachable_units);
+      CHECK(!type_exists(latest_type));
+
+      /* The new fn is still reachable, so the old one is still queued under it. */
+      CHECK(type_exists(old_type));
+      CHECK(runtime::detail::equal(rt_ctx.eval_string("(reloaded)"), make_box(2)));
+    }
   }
 }
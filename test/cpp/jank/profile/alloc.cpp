@@ -0,0 +1,98 @@
+#include <csignal>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include <fmt/format.h>
+
+#include <jank/type.hpp>
+#include <jank/profile/alloc.hpp>
+#include <jank/util/cli.hpp>
+
+/* This must go last; doctest and glog both define CHECK and family. */
+#include <doctest/doctest.h>
+
+namespace jank::profile
+{
+  /* Samples are global and only ever added to, so each case uses its own labels. */
+  static std::filesystem::path const output_path{ std::filesystem::temp_directory_path()
+                                                  / "jank-test.alloc.folded" };
+
+  static void start_sampling()
+  {
+    util::cli::options opts;
+    opts.alloc_sample_rate = 1;
+    opts.alloc_profile_file = output_path.string();
+    configure_alloc(opts);
+  }
+
+  static native_bool dumped_line(std::string const &expected)
+  {
+    std::ifstream input{ output_path };
+    std::string line;
+    while(std::getline(input, line))
+    {
+      if(line == expected)
+      {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  TEST_SUITE("profile::alloc")
+  {
+    TEST_CASE("Scopes")
+    {
+      start_sampling();
+
+      {
+        alloc_scope const outer{ "scope_outer" };
+        {
+          alloc_scope const inner{ "scope_inner" };
+          count_allocation("scope_test", 16);
+          count_allocation("scope_test", 16);
+        }
+        /* The inner scope is popped, so this is only attributed to the outer one. */
+        count_allocation("scope_test", 8);
+      }
+      count_allocation("scope_test", 4);
+
+      alloc_sampling = false;
+      dump_allocations();
+      CHECK(dumped_line("scope_outer;scope_inner;[scope_test] 32"));
+      CHECK(dumped_line("scope_outer;[scope_test] 8"));
+      CHECK(dumped_line("[native];[scope_test] 4"));
+    }
+
+    TEST_CASE("Native allocator")
+    {
+      start_sampling();
+
+      {
+        alloc_scope const scope{ "native_allocator_scope" };
+        native_allocator<int> allocator;
+        auto * const ints(allocator.allocate(6));
+        allocator.deallocate(ints, 6);
+      }
+
+      alloc_sampling = false;
+      dump_allocations();
+      CHECK(dumped_line(fmt::format("native_allocator_scope;[native] {}", 6 * sizeof(int))));
+    }
+
+    TEST_CASE("Dump on SIGUSR2")
+    {
+      start_sampling();
+      std::filesystem::remove(output_path);
+
+      /* The handler only flags the dump; it happens on the next sample. */
+      std::raise(SIGUSR2);
+      CHECK(!std::filesystem::exists(output_path));
+      count_allocation("signal_test", 2);
+      alloc_sampling = false;
+
+      CHECK(dumped_line("[native];[signal_test] 2"));
+    }
+  }
+}
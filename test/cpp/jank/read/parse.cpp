@@ -685,6 +685,20 @@ namespace jank::read::parse
                                        runtime::obj::boolean::true_const())));
       }
 
+      SUBCASE("Symbol meta is a tag")
+      {
+        lex::processor lp{ "^vector []" };
+        runtime::context rt_ctx;
+        processor p{ rt_ctx, lp.begin(), lp.end() };
+        auto const r(p.next());
+        CHECK(runtime::detail::equal(r.expect_ok().unwrap().ptr,
+                                     runtime::obj::persistent_vector::empty()));
+        CHECK(runtime::detail::equal(runtime::meta(r.expect_ok().unwrap().ptr),
+                                     runtime::obj::persistent_array_map::create_unique(
+                                       rt_ctx.intern_keyword("tag").expect_ok(),
+                                       make_box<runtime::obj::symbol>("vector"))));
+      }
+
       SUBCASE("Keyword meta for non-metadatable target")
       {
         lex::processor lp{ "^:foo nil" };
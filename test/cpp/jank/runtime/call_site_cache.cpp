@@ -0,0 +1,62 @@
+#include <jank/runtime/call_site_cache.hpp>
+#include <jank/runtime/seq.hpp>
+#include <jank/runtime/detail/object_util.hpp>
+
+/* This must go last; doctest and glog both define CHECK and family. */
+#include <doctest/doctest.h>
+
+namespace jank::runtime
+{
+  TEST_SUITE("runtime::call_site_cache")
+  {
+    TEST_CASE("Arity flags")
+    {
+      using behavior::callable;
+
+      CHECK(call_site_cache::is_direct(callable::build_arity_flags(2, false, false), 2));
+      /* ([a & args]) called with 1 or more args packs them. */
+      CHECK(!call_site_cache::is_direct(callable::build_arity_flags(1, true, false), 1));
+      CHECK(!call_site_cache::is_direct(callable::build_arity_flags(1, true, false), 3));
+      /* ([a] ...) ([a & args] ...) called with 1 arg is the fixed arity. */
+      CHECK(call_site_cache::is_direct(callable::build_arity_flags(1, true, true), 1));
+      CHECK(!call_site_cache::is_direct(callable::build_arity_flags(1, true, true), 2));
+      CHECK(!call_site_cache::is_direct(callable::build_arity_flags(0, true, false), 0));
+    }
+
+    TEST_CASE("Hits and misses")
+    {
+      call_site_cache site;
+      auto const first_fn(
+        make_box<obj::native_function_wrapper>(static_cast<object_ptr (*)(object_ptr)>(&first)));
+      auto const vec(make_box<obj::persistent_vector>(std::in_place, make_box(1), make_box(2)));
+
+      CHECK(detail::equal(site.call(first_fn, vec), make_box(1)));
+      CHECK(site.entries[0].load() == &typeid(*first_fn.data));
+      CHECK(detail::equal(site.call(first_fn, vec), make_box(1)));
+      CHECK(site.next_entry.load() == 1);
+
+      /* Non-fn callables aren't cached, but still work. */
+      auto const key(make_box("a"));
+      auto const map(obj::persistent_array_map::create_unique(key, make_box(3)));
+      CHECK(detail::equal(site.call(map, key), make_box(3)));
+      CHECK(site.next_entry.load() == 1);
+    }
+
+    TEST_CASE("Unloaded code")
+    {
+      call_site_cache site;
+      auto const first_fn(
+        make_box<obj::native_function_wrapper>(static_cast<object_ptr (*)(object_ptr)>(&first)));
+      auto const vec(make_box<obj::persistent_vector>(std::in_place, make_box(1), make_box(2)));
+
+      CHECK(detail::equal(site.call(first_fn, vec), make_box(1)));
+      CHECK(site.entries[0].load() == &typeid(*first_fn.data));
+
+      /* Cached types may have been unloaded, so they're all dropped. */
+      ++code_epoch;
+      CHECK(detail::equal(site.call(first_fn, vec), make_box(1)));
+      CHECK(site.entries[0].load() == nullptr);
+      CHECK(site.entries[1].load() == &typeid(*first_fn.data));
+    }
+  }
+}
@@ -39,5 +39,85 @@ namespace jank::runtime
         CHECK(expect_object<ns>(ctx.current_ns_var->deref())->name->equal(obj::symbol("", "test")));
       }
     }
+
+    namespace
+    {
+      object_ptr native_zero()
+      {
+        return make_box(0);
+      }
+
+      object_ptr native_identity(object_ptr const o)
+      {
+        return o;
+      }
+
+      object_ptr native_second(object_ptr const, object_ptr const o)
+      {
+        return o;
+      }
+    }
+
+    TEST_CASE("Native fns")
+    {
+      context ctx;
+      auto const n(ctx.intern_native_fns(
+        "native.test",
+        { { "multi", { &native_zero, &native_identity, &native_second } },
+          { "identity", &native_identity } }));
+      CHECK(n->name->equal(obj::symbol("", "native.test")));
+
+      auto const multi(ctx.find_var("native.test", "multi").unwrap()->deref());
+      CHECK(detail::equal(dynamic_call(multi), make_box(0)));
+      CHECK(detail::equal(dynamic_call(multi, make_box(1)), make_box(1)));
+      CHECK(detail::equal(dynamic_call(multi, make_box(1), make_box(2)), make_box(2)));
+      CHECK_THROWS(dynamic_call(multi, make_box(1), make_box(2), make_box(3)));
+
+      auto const identity(ctx.find_var("native.test", "identity").unwrap()->deref());
+      CHECK(detail::equal(dynamic_call(identity, make_box(5)), make_box(5)));
+      CHECK_THROWS(dynamic_call(identity));
+    }
+
+    TEST_CASE("Constants")
+    {
+      context ctx;
+      auto const vec([] {
+        return make_box<obj::persistent_vector>(std::in_place, make_box(1), make_box("two"));
+      });
+
+      auto const first(ctx.intern_constant(vec()));
+      CHECK(first == ctx.intern_constant(vec()));
+      CHECK(object_ptr{ first } == ctx.intern_constant(object_ptr{ vec() }));
+
+      /* These are all equal, but they can still be told apart. */
+      auto const list(make_box<obj::persistent_list>(std::in_place, make_box(1), make_box("two")));
+      CHECK(detail::equal(list, first));
+      CHECK(object_ptr{ ctx.intern_constant(list) } != object_ptr{ first });
+
+      auto const meta(obj::persistent_array_map::create_unique(
+        ctx.intern_keyword("tag").expect_ok(),
+        obj::boolean::true_const()));
+      auto const with_meta(
+        make_box<obj::persistent_vector>(meta, std::in_place, make_box(1), make_box("two")));
+      CHECK(ctx.intern_constant(with_meta) != first);
+      CHECK(ctx.intern_constant(make_box<obj::persistent_vector>(meta,
+                                                                 std::in_place,
+                                                                 make_box(1),
+                                                                 make_box("two")))
+            == ctx.intern_constant(with_meta));
+
+      auto const real(
+        make_box<obj::persistent_vector>(std::in_place, make_box(1.0l), make_box("two")));
+      CHECK(ctx.intern_constant(real) != first);
+
+      /* Equal reals aren't necessarily identical. */
+      auto const zero(ctx.intern_constant(make_box(0.0l)));
+      CHECK(zero == ctx.intern_constant(make_box(0.0l)));
+      CHECK(zero != ctx.intern_constant(make_box(-0.0l)));
+
+      /* Static constants are held outside of the pool, but still come from it. */
+      auto const &held(ctx.intern_static_constant(vec()));
+      CHECK(held == first);
+    }
   }
 }
@@ -0,0 +1,80 @@
+#include <gc/gc_mark.h>
+
+#include <jank/runtime/obj/cons.hpp>
+#include <jank/runtime/obj/persistent_vector.hpp>
+#include <jank/runtime/obj/symbol.hpp>
+#include <jank/runtime/var.hpp>
+#include <jank/runtime/seq.hpp>
+#include <jank/runtime/detail/object_util.hpp>
+
+/* This must go last; doctest and glog both define CHECK and family. */
+#include <doctest/doctest.h>
+
+namespace jank::runtime
+{
+  TEST_SUITE("runtime::gc_layout")
+  {
+    TEST_CASE("Described types")
+    {
+      static_assert(jank::detail::gc_described<obj::cons>);
+      static_assert(jank::detail::gc_described<obj::symbol>);
+      static_assert(jank::detail::gc_described<var>);
+      static_assert(!jank::detail::gc_described<obj::integer>);
+      static_assert(!obj::symbol::pointer_free);
+
+      /* The descriptor is built once and then reused. */
+      CHECK_EQ(jank::detail::gc_layout<obj::cons>::descriptor(),
+               jank::detail::gc_layout<obj::cons>::descriptor());
+    }
+
+    TEST_CASE("Leaves are pointer free")
+    {
+      static_assert(jank::detail::gc_pointer_free<obj::integer>);
+      static_assert(jank::detail::gc_pointer_free<native_integer>);
+      static_assert(!jank::detail::gc_pointer_free<object_ptr>);
+      static_assert(!jank::detail::gc_pointer_free<obj::cons>);
+
+      auto const kind([](void const * const p) {
+        return GC_get_kind_and_size(p, nullptr);
+      });
+      CHECK_EQ(kind(make_box(1).data), GC_I_PTRFREE);
+      CHECK_EQ(kind(make_array_box<native_integer>(native_integer{ 1 }, native_integer{ 2 }).data),
+               GC_I_PTRFREE);
+      CHECK_EQ(kind(make_array_box<native_real>(size_t{ 16 }).data), GC_I_PTRFREE);
+      CHECK_EQ(kind(make_array_box<object_ptr>(size_t{ 16 }).data), GC_I_NORMAL);
+
+      native_vector<native_integer> ints{ 1, 2, 3 };
+      CHECK_EQ(kind(ints.data()), GC_I_PTRFREE);
+      /* Long enough to not be stored inline. */
+      native_persistent_string const s{ native_transient_string(64, 's') };
+      CHECK_EQ(kind(s.data()), GC_I_PTRFREE);
+    }
+
+    TEST_CASE("Members survive a collection")
+    {
+      /* Only reachable through the typed words of each object. */
+      obj::cons_ptr list{ make_box<obj::cons>(make_box(0), obj::nil::nil_const()) };
+      for(native_integer i{ 1 }; i < 1000; ++i)
+      {
+        list = make_box<obj::cons>(make_box(i), list);
+      }
+      /* Long enough to not be stored inline. */
+      auto const sym(make_box<obj::symbol>(native_transient_string(64, 'n'),
+                                           native_transient_string(64, 's')));
+      auto const vec(make_box<obj::persistent_vector>(std::in_place, make_box("kept")));
+
+      GC_gcollect();
+
+      native_integer expected{ 999 };
+      for(object_ptr it{ list }; it != obj::nil::nil_const();
+          it = expect_object<obj::cons>(it)->tail)
+      {
+        CHECK(detail::equal(expect_object<obj::cons>(it)->head, make_box(expected--)));
+      }
+      CHECK_EQ(expected, -1);
+      CHECK_EQ(sym->ns, native_persistent_string{ native_transient_string(64, 'n') });
+      CHECK_EQ(sym->name, native_persistent_string{ native_transient_string(64, 's') });
+      CHECK(detail::equal(vec->data[0], make_box("kept")));
+    }
+  }
+}
@@ -0,0 +1,108 @@
+#include <jank/runtime/obj/nil.hpp>
+#include <jank/runtime/obj/number.hpp>
+#include <jank/runtime/obj/persistent_string.hpp>
+#include <jank/runtime/obj/keyword.hpp>
+#include <jank/runtime/obj/symbol.hpp>
+#include <jank/runtime/obj/cons.hpp>
+#include <jank/runtime/obj/range.hpp>
+#include <jank/runtime/obj/iterator.hpp>
+#include <jank/runtime/obj/persistent_list.hpp>
+#include <jank/runtime/obj/persistent_vector.hpp>
+#include <jank/runtime/obj/persistent_set.hpp>
+#include <jank/runtime/obj/persistent_array_map.hpp>
+#include <jank/runtime/obj/persistent_hash_map.hpp>
+#include <jank/runtime/obj/transient_vector.hpp>
+#include <jank/runtime/obj/transient_set.hpp>
+#include <jank/runtime/obj/transient_hash_map.hpp>
+#include <jank/runtime/obj/transient_string.hpp>
+#include <jank/runtime/obj/native_function_wrapper.hpp>
+#include <jank/runtime/obj/native_array_sequence.hpp>
+#include <jank/runtime/obj/persistent_vector_sequence.hpp>
+
+/* This must go last; doctest and glog both define CHECK and family. */
+#include <doctest/doctest.h>
+
+namespace jank::runtime
+{
+  /* Every object is allocated many times over, so a stray field, or one put in the wrong
+   * place, costs a word per object. These pin down the layout of each type, so any growth
+   * is deliberate. Sizes are in terms of words, with the header and any cached hash sharing
+   * the first one. */
+  TEST_SUITE("runtime::object_size")
+  {
+    static constexpr size_t word{ sizeof(object_ptr) };
+
+    TEST_CASE("Header")
+    {
+      CHECK_EQ(sizeof(object), 1u);
+      CHECK_EQ(sizeof(object_type), 1u);
+      CHECK_EQ(sizeof(option<object_ptr>), word);
+      CHECK_EQ(sizeof(option<obj::symbol_ptr>), word);
+    }
+
+    TEST_CASE("Option")
+    {
+      option<object_ptr> o;
+      CHECK(o.is_none());
+      o = obj::nil::nil_const();
+      CHECK(o.is_some());
+      CHECK(o.unwrap() == obj::nil::nil_const());
+
+      option<object_ptr> const moved{ std::move(o) };
+      CHECK(moved.is_some());
+      CHECK(o.is_none());
+
+      option<obj::nil_ptr> const typed{ obj::nil::nil_const() };
+      option<object_ptr> const converted{ typed };
+      CHECK(converted == moved);
+      CHECK(option<object_ptr>{ none }.unwrap_or(nullptr) == nullptr);
+    }
+
+    TEST_CASE("Scalars")
+    {
+      CHECK_EQ(sizeof(obj::nil), 1u);
+      CHECK_EQ(sizeof(obj::boolean), 2u);
+      CHECK_EQ(sizeof(obj::integer), 2 * word);
+      /* native_real is a long double, which is aligned to its own, larger, size, so the header
+       * gets a padded slot of that size. */
+      CHECK_EQ(sizeof(obj::real), alignof(native_real) + sizeof(native_real));
+      CHECK_EQ(sizeof(obj::persistent_string), word + sizeof(native_persistent_string));
+      CHECK_EQ(sizeof(obj::symbol), 2 * word + 2 * sizeof(native_persistent_string));
+      CHECK_EQ(sizeof(obj::keyword), word + sizeof(obj::symbol));
+    }
+
+    TEST_CASE("Sequences")
+    {
+      CHECK_EQ(sizeof(obj::cons), 3 * word);
+      CHECK_EQ(sizeof(obj::range), 5 * word);
+      CHECK_EQ(sizeof(obj::iterator), 5 * word);
+      CHECK_EQ(sizeof(obj::native_array_sequence), 4 * word);
+      CHECK_EQ(sizeof(obj::persistent_vector_sequence), 3 * word);
+    }
+
+    TEST_CASE("Collections")
+    {
+      CHECK_EQ(sizeof(obj::persistent_list),
+               2 * word + sizeof(obj::persistent_list::value_type));
+      CHECK_EQ(sizeof(obj::persistent_vector),
+               2 * word + sizeof(obj::persistent_vector::value_type));
+      CHECK_EQ(sizeof(obj::persistent_set), 2 * word + sizeof(obj::persistent_set::value_type));
+      CHECK_EQ(sizeof(obj::persistent_array_map),
+               2 * word + sizeof(obj::persistent_array_map::value_type));
+      CHECK_EQ(sizeof(obj::persistent_hash_map),
+               2 * word + sizeof(obj::persistent_hash_map::value_type));
+      /* Callables have a vtable pointer ahead of the header. */
+      CHECK_EQ(sizeof(obj::native_function_wrapper),
+               3 * word + sizeof(obj::detail::function_type));
+    }
+
+    TEST_CASE("Transients")
+    {
+      CHECK_EQ(sizeof(obj::transient_vector), word + sizeof(obj::transient_vector::value_type));
+      CHECK_EQ(sizeof(obj::transient_set), word + sizeof(obj::transient_set::value_type));
+      CHECK_EQ(sizeof(obj::transient_hash_map),
+               word + sizeof(obj::transient_hash_map::value_type));
+      CHECK_EQ(sizeof(obj::transient_string), word + sizeof(obj::transient_string::value_type));
+    }
+  }
+}
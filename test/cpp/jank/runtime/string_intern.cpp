@@ -0,0 +1,48 @@
+#include <jank/read/lex.hpp>
+#include <jank/read/parse.hpp>
+#include <jank/runtime/context.hpp>
+#include <jank/runtime/string_intern.hpp>
+#include <jank/runtime/detail/object_util.hpp>
+
+/* This must go last; doctest and glog both define CHECK and family. */
+#include <doctest/doctest.h>
+
+namespace jank::runtime
+{
+  TEST_SUITE("runtime::string_intern")
+  {
+    TEST_CASE("Same contents")
+    {
+      auto const small(intern_string("small"));
+      CHECK(small == intern_string(native_persistent_string{ "small" }));
+      CHECK(small != intern_string("other"));
+
+      /* Long enough to not be stored inline. */
+      native_transient_string const contents(64, 'l');
+      auto const large(intern_string(contents));
+      CHECK(large == intern_string(native_persistent_string{ contents }));
+      CHECK(large->data.data() == intern_string(contents)->data.data());
+    }
+
+    TEST_CASE("Objects")
+    {
+      auto const fresh(make_box<obj::persistent_string>("only one"));
+      CHECK(intern_string(fresh) == fresh);
+      CHECK(intern_string(make_box<obj::persistent_string>("only one")) == fresh);
+      CHECK(object_ptr{ fresh } == intern_str(make_box<obj::persistent_string>("only one")));
+      CHECK_THROWS(intern_str(make_box(1)));
+    }
+
+    TEST_CASE("Reader literals")
+    {
+      context rt_ctx;
+      rt_ctx.intern_strings = true;
+      read::lex::processor lp{ R"("read twice" "read twice")" };
+      read::parse::processor p{ rt_ctx, lp.begin(), lp.end() };
+      auto const first(p.next().expect_ok().unwrap().ptr);
+      auto const second(p.next().expect_ok().unwrap().ptr);
+      CHECK(first == second);
+      CHECK(first == object_ptr{ intern_string("read twice") });
+    }
+  }
+}
@@ -0,0 +1,55 @@
+#include <jank/util/arena.hpp>
+#include <jank/analyze/expression.hpp>
+
+/* This must go last; doctest and glog both define CHECK and family. */
+#include <doctest/doctest.h>
+
+namespace jank::util
+{
+  TEST_SUITE("util::arena")
+  {
+    TEST_CASE("Bump allocation")
+    {
+      arena a;
+      auto const first(static_cast<char *>(a.allocate(1, 1)));
+      auto const second(static_cast<char *>(a.allocate(8, 8)));
+      CHECK_EQ(reinterpret_cast<uintptr_t>(second) % 8, 0);
+      CHECK_GT(second, first);
+      CHECK_LT(second - first, 16);
+      CHECK_EQ(a.chunks.size(), 1);
+
+      /* Large allocations get their own chunk, without giving up the current one. */
+      auto const large(a.allocate(arena::chunk_size, 16));
+      CHECK_EQ(reinterpret_cast<uintptr_t>(large) % 16, 0);
+      CHECK_EQ(a.chunks.size(), 2);
+      auto const third(static_cast<char *>(a.allocate(8, 8)));
+      CHECK_EQ(third - second, 8);
+    }
+
+    TEST_CASE("Scopes")
+    {
+      CHECK_EQ(arena::current(), nullptr);
+      arena outer;
+      {
+        arena::scope const outer_scope{ outer };
+        CHECK_EQ(arena::current(), &outer);
+
+        auto const expr(make_box<analyze::expression>());
+        CHECK(!outer.chunks.empty());
+        CHECK_EQ(static_cast<void *>(expr.data), outer.chunks[0]);
+
+        arena inner;
+        {
+          arena::scope const inner_scope{ inner };
+          CHECK_EQ(arena::current(), &inner);
+        }
+        CHECK_EQ(arena::current(), &outer);
+
+        /* Runtime objects never come from the arena. */
+        auto const i(make_box(1));
+        CHECK_NE(static_cast<void *>(i.data), outer.chunks[0]);
+      }
+      CHECK_EQ(arena::current(), nullptr);
+    }
+  }
+}